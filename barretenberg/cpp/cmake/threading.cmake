@@ -35,3 +35,16 @@ else()
         add_definitions(-DNO_TBB)
     endif()
 endif()
+
+if(ENABLE_LIBNUMA)
+    find_library(NUMA_LIBRARY numa)
+    find_path(NUMA_INCLUDE_DIR numa.h)
+    if(NUMA_LIBRARY AND NUMA_INCLUDE_DIR)
+        message(STATUS "libnuma is enabled.")
+        add_definitions(-DBB_LIBNUMA)
+        include_directories(${NUMA_INCLUDE_DIR})
+        link_libraries(${NUMA_LIBRARY})
+    else()
+        message(STATUS "Could not locate libnuma.")
+    endif()
+endif()
@@ -6,6 +6,7 @@
 #include "common/mem.hpp"
 #include "common/serialize.hpp"
 #include "common/streams.hpp"
+#include "common/thread.hpp"
 #include "common/throw_or_abort.hpp"
 #include "crypto/blake2s/blake2s.hpp"
 #include "crypto/blake3s/blake3s.hpp"
@@ -4,12 +4,16 @@
 #include "get_witness.hpp"
 #include "log.hpp"
 #include <barretenberg/common/container.hpp>
+#include <barretenberg/common/memory_policy.hpp>
+#include <barretenberg/common/memory_usage.hpp>
+#include <barretenberg/common/trace.hpp>
 #include <barretenberg/dsl/acir_format/acir_to_constraint_buf.hpp>
 #include <barretenberg/dsl/acir_proofs/acir_composer.hpp>
 #include <barretenberg/srs/global_crs.hpp>
 #include <iostream>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 using namespace barretenberg;
@@ -17,6 +21,8 @@ using namespace barretenberg;
 const uint32_t MAX_CIRCUIT_SIZE = 1 << 22;
 std::string CRS_PATH = "./crs";
 bool verbose = false;
+// Bound on the memory held by the proving key's polynomials, in bytes. 0 means unbounded.
+size_t MEMORY_BUDGET = 0;
 
 void init()
 {
@@ -54,6 +60,7 @@ acir_format::acir_format get_constraint_system(std::string const& bytecode_path)
 bool proveAndVerify(const std::string& bytecodePath, const std::string& witnessPath, bool recursive)
 {
     auto acir_composer = new acir_proofs::AcirComposer(MAX_CIRCUIT_SIZE, verbose);
+    acir_composer->set_memory_budget(MEMORY_BUDGET);
     auto constraint_system = get_constraint_system(bytecodePath);
     auto witness = get_witness(witnessPath);
     auto proof = acir_composer->create_proof(srs::get_crs_factory(), constraint_system, witness, recursive);
@@ -81,6 +88,7 @@ void prove(const std::string& bytecodePath,
            const std::string& outputPath)
 {
     auto acir_composer = new acir_proofs::AcirComposer(MAX_CIRCUIT_SIZE, verbose);
+    acir_composer->set_memory_budget(MEMORY_BUDGET);
     auto constraint_system = get_constraint_system(bytecodePath);
     auto witness = get_witness(witnessPath);
     auto proof = acir_composer->create_proof(srs::get_crs_factory(), constraint_system, witness, recursive);
@@ -154,6 +162,7 @@ bool verify(const std::string& proof_path, bool recursive, const std::string& vk
 void writeVk(const std::string& bytecodePath, const std::string& outputPath)
 {
     auto acir_composer = new acir_proofs::AcirComposer(MAX_CIRCUIT_SIZE, verbose);
+    acir_composer->set_memory_budget(MEMORY_BUDGET);
     auto constraint_system = get_constraint_system(bytecodePath);
     acir_composer->init_proving_key(srs::get_crs_factory(), constraint_system);
     auto vk = acir_composer->init_verification_key();
@@ -314,6 +323,77 @@ std::string getOption(std::vector<std::string>& args, const std::string& option,
     return (itr != args.end() && std::next(itr) != args.end()) ? *(std::next(itr)) : defaultValue;
 }
 
+/**
+ * @brief Parse a size in bytes, optionally suffixed with K, M or G (powers of 1024), e.g. "8G".
+ */
+size_t parseMemorySize(const std::string& size)
+{
+    size_t suffix_pos = 0;
+    size_t value = std::stoull(size, &suffix_pos);
+    std::string suffix = size.substr(suffix_pos);
+    if (suffix.empty()) {
+        return value;
+    } else if (suffix == "K" || suffix == "k") {
+        return value << 10;
+    } else if (suffix == "M" || suffix == "m") {
+        return value << 20;
+    } else if (suffix == "G" || suffix == "g") {
+        return value << 30;
+    }
+    throw std::runtime_error("Invalid memory size: " + size);
+}
+
+/**
+ * @brief Records prover stage spans for the lifetime of the command and writes them out as a Chrome trace on exit.
+ */
+class TraceSession {
+  public:
+    explicit TraceSession(std::string path)
+        : path(std::move(path))
+    {
+        if (!this->path.empty()) {
+            trace::start_recording();
+        }
+    }
+    ~TraceSession()
+    {
+        if (path.empty()) {
+            return;
+        }
+        trace::stop_recording();
+        if (trace::write_chrome_trace(path)) {
+            vinfo("trace written to: ", path);
+        } else {
+            std::cerr << "Failed to write trace to: " << path << "\n";
+        }
+    }
+    TraceSession(const TraceSession&) = delete;
+    TraceSession(TraceSession&&) = delete;
+    TraceSession& operator=(const TraceSession&) = delete;
+    TraceSession& operator=(TraceSession&&) = delete;
+
+  private:
+    std::string path;
+};
+
+/**
+ * @brief Logs the peak resident set size of the process on exit, so that operators can size machines for their circuits.
+ */
+class PeakMemoryReport {
+  public:
+    PeakMemoryReport() = default;
+    ~PeakMemoryReport()
+    {
+        if (verbose || MEMORY_BUDGET != 0) {
+            info("peak rss: ", get_peak_rss_bytes() >> 20, "MiB");
+        }
+    }
+    PeakMemoryReport(const PeakMemoryReport&) = delete;
+    PeakMemoryReport(PeakMemoryReport&&) = delete;
+    PeakMemoryReport& operator=(const PeakMemoryReport&) = delete;
+    PeakMemoryReport& operator=(PeakMemoryReport&&) = delete;
+};
+
 int main(int argc, char* argv[])
 {
     try {
@@ -333,6 +413,15 @@ int main(int argc, char* argv[])
         std::string vk_path = getOption(args, "-k", "./target/vk");
         CRS_PATH = getOption(args, "-c", "./crs");
         bool recursive = flagPresent(args, "-r") || flagPresent(args, "--recursive");
+        std::string trace_path = getOption(args, "--trace", "");
+        MEMORY_BUDGET = parseMemorySize(getOption(args, "--memory-budget", "0"));
+        std::string memory_policy = getOption(args, "--memory-policy", "first-touch");
+        if (auto policy = barretenberg::parse_memory_policy(memory_policy)) {
+            barretenberg::set_memory_policy(*policy);
+        } else {
+            std::cerr << "Invalid memory policy: " << memory_policy << " (expected serial, first-touch or interleave).\n";
+            return 1;
+        }
 
         // Skip CRS initialization for any command which doesn't require the CRS.
         if (command == "--version") {
@@ -344,6 +433,13 @@ int main(int argc, char* argv[])
             return 0;
         }
 
+        if (!trace_path.empty() && !trace::compiled_in()) {
+            std::cerr << "--trace requires a build configured with -DENABLE_TRACING=ON.\n";
+            return 1;
+        }
+        TraceSession trace_session(trace_path);
+        PeakMemoryReport peak_memory_report;
+
         init();
 
         if (command == "prove_and_verify") {
@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+"""Compare two sets of end-to-end benchmark results (as written by e2e_bench) and fail on regressions.
+
+Usage:
+    compare.py baseline.json branch.json [--time-threshold 0.1] [--rss-threshold 0.1] [--stage-threshold 0.25]
+
+A benchmark regresses when its wall time or peak RSS grows by more than the given fraction of the baseline, or when it
+no longer verifies. Per-stage times are reported, and only gate the result if --stage-threshold is given, as individual
+stages are noisier than the whole. Benchmarks present in only one of the files are reported but are not regressions.
+"""
+import argparse
+import json
+import sys
+
+
+def load(path):
+    with open(path) as f:
+        return {b["name"]: b for b in json.load(f)["benchmarks"]}
+
+
+def change(base, new):
+    return (new - base) / base if base else 0.0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline")
+    parser.add_argument("branch")
+    parser.add_argument("--time-threshold", type=float, default=0.1)
+    parser.add_argument("--rss-threshold", type=float, default=0.1)
+    parser.add_argument("--stage-threshold", type=float, default=None)
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    branch = load(args.branch)
+    regressions = []
+
+    for name in sorted(set(baseline) | set(branch)):
+        if name not in baseline or name not in branch:
+            print(f"{name}: only in {'branch' if name in branch else 'baseline'}")
+            continue
+        base, new = baseline[name], branch[name]
+        print(f"{name}:")
+
+        if not new["verified"]:
+            regressions.append(f"{name}: proof failed to verify")
+
+        checks = [("wall_time_ms", base["wall_time_ms"], new["wall_time_ms"], args.time_threshold),
+                  ("peak_rss_bytes", base["peak_rss_bytes"], new["peak_rss_bytes"], args.rss_threshold)]
+        for stage in base["stages_ms"]:
+            if stage in new["stages_ms"]:
+                checks.append((f"stages_ms.{stage}", base["stages_ms"][stage], new["stages_ms"][stage],
+                               args.stage_threshold))
+
+        for metric, base_value, new_value, threshold in checks:
+            delta = change(base_value, new_value)
+            flag = ""
+            if threshold is not None and delta > threshold:
+                flag = "  REGRESSION"
+                regressions.append(f"{name}: {metric} +{delta:.1%} (threshold {threshold:.0%})")
+            print(f"  {metric:<40} {base_value:>14.1f} -> {new_value:>14.1f}  {delta:+7.1%}{flag}")
+
+    if regressions:
+        print("\nRegressions:")
+        for regression in regressions:
+            print(f"  {regression}")
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,176 @@
+#pragma once
+#include "barretenberg/common/memory_usage.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/timer.hpp"
+#include "barretenberg/common/trace.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * Harness for end-to-end proving benchmarks.
+ *
+ * Unlike the google-benchmark suites, which time a single operation, each workload here runs a whole proving pipeline
+ * (circuit construction, key construction, proving, verification) once per repetition, recording the wall time, the
+ * peak RSS and the time spent in each stage. Results are written as JSON so that they can be checked in as a baseline
+ * and compared against with compare.py, e.g.
+ * ```
+ *     ./bin/e2e_bench -o baseline.json
+ *     ... make changes, rebuild ...
+ *     ./bin/e2e_bench -o branch.json
+ *     ../src/barretenberg/benchmark/e2e_bench/compare.py baseline.json branch.json --time-threshold 0.05
+ * ```
+ * In builds configured with -DENABLE_TRACING=ON the totals of the finer grained trace spans (FFTs, MSMs, sumcheck, ...)
+ * are recorded too.
+ */
+namespace e2e_bench {
+
+struct Measurement {
+    std::string name;
+    size_t num_gates = 0;
+    double wall_time_ms = 0;
+    size_t peak_rss_bytes = 0;
+    bool verified = false;
+    // In the order in which the stages ran.
+    std::vector<std::pair<std::string, double>> stage_times_ms;
+    std::map<std::string, barretenberg::trace::StageTotal> trace_stages;
+
+    /**
+     * @brief Run func as the named stage of the workload, returning its result.
+     */
+    template <typename Func> auto time_stage(std::string const& stage, Func&& func)
+    {
+        Timer timer;
+        if constexpr (std::is_void_v<std::invoke_result_t<Func>>) {
+            func();
+            stage_times_ms.emplace_back(stage, static_cast<double>(timer.nanoseconds()) / 1e6);
+        } else {
+            auto result = func();
+            stage_times_ms.emplace_back(stage, static_cast<double>(timer.nanoseconds()) / 1e6);
+            return result;
+        }
+    }
+};
+
+struct Workload {
+    std::string name;
+    std::function<void(Measurement&)> run;
+};
+
+/**
+ * @brief Run a workload the given number of times, keeping the fastest repetition.
+ * @details The peak RSS reported is the largest seen across all repetitions.
+ */
+inline Measurement run_workload(Workload const& workload, size_t repetitions)
+{
+    Measurement best;
+    size_t peak_rss_bytes = 0;
+    for (size_t i = 0; i < repetitions; ++i) {
+        barretenberg::trace::clear();
+        barretenberg::reset_peak_rss();
+
+        Measurement measurement;
+        measurement.name = workload.name;
+        Timer timer;
+        workload.run(measurement);
+        measurement.wall_time_ms = static_cast<double>(timer.nanoseconds()) / 1e6;
+        measurement.peak_rss_bytes = barretenberg::get_peak_rss_bytes();
+        measurement.trace_stages = barretenberg::trace::stage_totals();
+
+        peak_rss_bytes = std::max(peak_rss_bytes, measurement.peak_rss_bytes);
+        if (i == 0 || measurement.wall_time_ms < best.wall_time_ms) {
+            best = std::move(measurement);
+        }
+    }
+    best.peak_rss_bytes = peak_rss_bytes;
+    return best;
+}
+
+inline void write_json(std::ostream& os, std::vector<Measurement> const& measurements, size_t repetitions)
+{
+    os << "{\n  \"context\": {\"num_cpus\": " << get_num_cpus() << ", \"repetitions\": " << repetitions
+       << ", \"tracing\": " << (barretenberg::trace::compiled_in() ? "true" : "false") << "},\n";
+    os << "  \"benchmarks\": [";
+    for (size_t i = 0; i < measurements.size(); ++i) {
+        auto const& m = measurements[i];
+        os << (i == 0 ? "\n" : ",\n");
+        os << "    {\"name\": \"" << m.name << "\", \"num_gates\": " << m.num_gates
+           << ", \"verified\": " << (m.verified ? "true" : "false") << ", \"wall_time_ms\": " << m.wall_time_ms
+           << ", \"peak_rss_bytes\": " << m.peak_rss_bytes << ",\n     \"stages_ms\": {";
+        for (size_t j = 0; j < m.stage_times_ms.size(); ++j) {
+            os << (j == 0 ? "" : ", ") << "\"" << m.stage_times_ms[j].first << "\": " << m.stage_times_ms[j].second;
+        }
+        os << "},\n     \"trace_ms\": {";
+        bool first = true;
+        for (auto const& [stage, total] : m.trace_stages) {
+            os << (first ? "" : ", ") << "\"" << stage << "\": " << static_cast<double>(total.total_ns) / 1e6;
+            first = false;
+        }
+        os << "}}";
+    }
+    os << "\n  ]\n}\n";
+}
+
+/**
+ * @brief Entry point shared by the end-to-end benchmark executables.
+ * @details Options:
+ *   -o <path>          where to write the JSON results, `-` for stdout (default: e2e_bench.json)
+ *   --filter <substr>  only run workloads whose name contains substr
+ *   --repetitions <n>  number of times to run each workload (default: 1)
+ *   --list             print the workload names and exit
+ * Progress is logged to stderr. Returns non-zero if any proof failed to verify.
+ */
+inline int run_suite(int argc, char* argv[], std::vector<Workload> const& workloads)
+{
+    std::vector<std::string> args(argv + 1, argv + argc);
+    auto get_option = [&](std::string const& option, std::string const& default_value) {
+        auto itr = std::find(args.begin(), args.end(), option);
+        return (itr != args.end() && std::next(itr) != args.end()) ? *(std::next(itr)) : default_value;
+    };
+    std::string output_path = get_option("-o", "e2e_bench.json");
+    std::string filter = get_option("--filter", "");
+    auto repetitions = static_cast<size_t>(std::stoul(get_option("--repetitions", "1")));
+
+    if (std::find(args.begin(), args.end(), "--list") != args.end()) {
+        for (auto const& workload : workloads) {
+            std::cout << workload.name << std::endl;
+        }
+        return 0;
+    }
+
+    if (barretenberg::trace::compiled_in()) {
+        barretenberg::trace::start_recording();
+    }
+
+    bool all_verified = true;
+    std::vector<Measurement> measurements;
+    for (auto const& workload : workloads) {
+        if (workload.name.find(filter) == std::string::npos) {
+            continue;
+        }
+        std::cerr << "Running " << workload.name << "..." << std::endl;
+        measurements.push_back(run_workload(workload, std::max<size_t>(repetitions, 1)));
+        auto const& m = measurements.back();
+        std::cerr << "  " << m.wall_time_ms << "ms, peak rss " << (m.peak_rss_bytes >> 20) << "MiB, "
+                  << (m.verified ? "verified" : "FAILED TO VERIFY") << std::endl;
+        all_verified &= m.verified;
+    }
+
+    if (output_path == "-") {
+        write_json(std::cout, measurements, repetitions);
+    } else {
+        std::ofstream file(output_path);
+        write_json(file, measurements, repetitions);
+        std::cerr << "Results written to: " << output_path << std::endl;
+    }
+    return all_verified ? 0 : 1;
+}
+
+} // namespace e2e_bench
@@ -0,0 +1,137 @@
+#include "e2e_bench.hpp"
+
+#include "barretenberg/benchmark/honk_bench/benchmark_utilities.hpp"
+#include "barretenberg/honk/composer/ultra_composer.hpp"
+#include "barretenberg/plonk/composer/ultra_composer.hpp"
+#include "barretenberg/stdlib/hash/blake3s/blake3s.hpp"
+#include "barretenberg/stdlib/hash/pedersen/pedersen.hpp"
+#include "barretenberg/stdlib/primitives/curves/bn254.hpp"
+#include "barretenberg/stdlib/recursion/verifier/program_settings.hpp"
+#include "barretenberg/stdlib/recursion/verifier/verifier.hpp"
+
+using namespace e2e_bench;
+using namespace proof_system;
+
+namespace {
+
+// Sized to be representative of real programs while keeping a full run of the suite to a few minutes.
+constexpr size_t NUM_SHA256_HASHES = 8;
+constexpr size_t NUM_ECDSA_VERIFICATIONS = 1;
+
+using Builder = UltraCircuitBuilder;
+
+/**
+ * @brief Construct, prove and verify an UltraPlonk proof of the circuit built by build_circuit.
+ */
+void prove_ultra_plonk(Measurement& measurement, std::function<void(Builder&)> const& build_circuit)
+{
+    Builder builder;
+    measurement.time_stage("construct_circuit", [&] { build_circuit(builder); });
+    measurement.num_gates = builder.get_num_gates();
+
+    plonk::UltraComposer composer;
+    auto prover = measurement.time_stage("construct_proving_key", [&] { return composer.create_prover(builder); });
+    auto proof = measurement.time_stage("prove", [&] { return prover.construct_proof(); });
+    measurement.verified = measurement.time_stage("verify", [&] {
+        auto verifier = composer.create_verifier(builder);
+        return verifier.verify_proof(proof);
+    });
+}
+
+/**
+ * @brief Construct, prove and verify an UltraHonk proof of the circuit built by build_circuit.
+ */
+void prove_ultra_honk(Measurement& measurement, std::function<void(Builder&)> const& build_circuit)
+{
+    Builder builder;
+    measurement.time_stage("construct_circuit", [&] { build_circuit(builder); });
+    measurement.num_gates = builder.get_num_gates();
+
+    honk::UltraComposer composer;
+    auto instance = measurement.time_stage("construct_proving_key", [&] { return composer.create_instance(builder); });
+    auto prover = composer.create_prover(instance);
+    auto proof = measurement.time_stage("prove", [&] { return prover.construct_proof(); });
+    measurement.verified = measurement.time_stage("verify", [&] {
+        auto verifier = composer.create_verifier(instance);
+        return verifier.verify_proof(proof);
+    });
+}
+
+/**
+ * @brief An UltraPlonk circuit which recursively verifies an UltraPlonk proof of a small circuit, as done by the rollup
+ * and kernel circuits.
+ */
+void build_recursive_verifier_circuit(Measurement& measurement, Builder& outer_builder)
+{
+    using outer_curve = plonk::stdlib::bn254<Builder>;
+    using field_ct = plonk::stdlib::field_t<Builder>;
+    using public_witness_ct = plonk::stdlib::public_witness_t<Builder>;
+    using verification_key_ct = plonk::stdlib::recursion::verification_key<outer_curve>;
+    using recursive_settings = plonk::stdlib::recursion::recursive_ultra_verifier_settings<outer_curve>;
+
+    Builder inner_builder;
+    field_ct a(public_witness_ct(&inner_builder, barretenberg::fr::random_element()));
+    field_ct b(public_witness_ct(&inner_builder, barretenberg::fr::random_element()));
+    for (size_t i = 0; i < 32; ++i) {
+        a = (a * b) + b + a;
+    }
+    plonk::stdlib::pedersen_commitment<Builder>::compress(a, b);
+    plonk::stdlib::byte_array<Builder> to_hash(&inner_builder, "nonsense test data");
+    plonk::stdlib::blake3s(to_hash);
+
+    plonk::UltraComposer inner_composer;
+    auto inner_proof = measurement.time_stage("prove_inner_circuit", [&] {
+        auto inner_prover = inner_composer.create_prover(inner_builder);
+        return inner_prover.construct_proof();
+    });
+    auto inner_verification_key = inner_composer.compute_verification_key(inner_builder);
+
+    measurement.time_stage("construct_circuit", [&] {
+        auto verification_key = verification_key_ct::from_witness(&outer_builder, inner_verification_key);
+        auto manifest = plonk::UltraComposer::create_manifest(inner_builder.public_inputs.size());
+        auto output = plonk::stdlib::recursion::verify_proof<outer_curve, recursive_settings>(
+            &outer_builder, verification_key, manifest, inner_proof);
+        output.add_proof_outputs_as_public_inputs();
+    });
+}
+
+void prove_recursive_verifier(Measurement& measurement)
+{
+    Builder builder;
+    build_recursive_verifier_circuit(measurement, builder);
+    measurement.num_gates = builder.get_num_gates();
+
+    plonk::UltraComposer composer;
+    auto prover = measurement.time_stage("construct_proving_key", [&] { return composer.create_prover(builder); });
+    auto proof = measurement.time_stage("prove", [&] { return prover.construct_proof(); });
+    measurement.verified = measurement.time_stage("verify", [&] {
+        auto verifier = composer.create_verifier(builder);
+        return verifier.verify_proof(proof);
+    });
+}
+
+void build_sha256_circuit(Builder& builder)
+{
+    bench_utils::generate_sha256_test_circuit(builder, NUM_SHA256_HASHES);
+}
+
+void build_ecdsa_circuit(Builder& builder)
+{
+    bench_utils::generate_ecdsa_verification_test_circuit(builder, NUM_ECDSA_VERIFICATIONS);
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    barretenberg::srs::init_crs_factory("../srs_db/ignition");
+
+    std::vector<Workload> workloads = {
+        { "ultra_plonk/sha256", [](Measurement& m) { prove_ultra_plonk(m, build_sha256_circuit); } },
+        { "ultra_honk/sha256", [](Measurement& m) { prove_ultra_honk(m, build_sha256_circuit); } },
+        { "ultra_plonk/ecdsa", [](Measurement& m) { prove_ultra_plonk(m, build_ecdsa_circuit); } },
+        { "ultra_honk/ecdsa", [](Measurement& m) { prove_ultra_honk(m, build_ecdsa_circuit); } },
+        { "ultra_plonk/recursive_verifier", prove_recursive_verifier },
+    };
+    return run_suite(argc, argv, workloads);
+}
@@ -4,6 +4,9 @@
 #include "barretenberg/honk/composer/ultra_composer.hpp"
 #include "barretenberg/proof_system/circuit_builder/ultra_circuit_builder.hpp"
 
+#include <optional>
+#include <vector>
+
 using namespace benchmark;
 using namespace proof_system::plonk;
 
@@ -26,7 +29,77 @@ void construct_proof_ultra(State& state, void (*test_circuit_function)(UltraBuil
     bench_utils::construct_proof_with_specified_num_iterations<UltraHonk>(state, test_circuit_function);
 }
 
+/**
+ * @brief Benchmark: Construction of the Ultra Honk prover instance, i.e. the proving key and the witness polynomials
+ * including the sorted lookup lists, for a circuit determined by the provided circuit function
+ */
+void construct_instance_ultra(State& state, void (*test_circuit_function)(UltraBuilder&, size_t)) noexcept
+{
+    barretenberg::srs::init_crs_factory("../srs_db/ignition");
+    auto num_iterations = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        // Constuct circuit; don't include this part in measurement
+        state.PauseTiming();
+        auto builder = UltraBuilder();
+        test_circuit_function(builder, num_iterations);
+        auto composer = UltraHonk();
+        state.ResumeTiming();
+
+        DoNotOptimize(composer.create_instance(builder));
+    }
+}
+
+/**
+ * @brief Benchmark: Verification throughput for a batch of Ultra Honk proofs of the same circuit, checking each proof
+ * with its own pairing or accumulating the pairing points of all of them into one pairing check
+ */
+void verify_proofs_ultra(State& state, bool accumulate) noexcept
+{
+    barretenberg::srs::init_crs_factory("../srs_db/ignition");
+    auto num_proofs = static_cast<size_t>(state.range(0));
+
+    // Proofs of the same circuit with different (random) witnesses
+    std::vector<proof_system::plonk::proof> proofs;
+    std::optional<proof_system::honk::UltraVerifier> verifier;
+    for (size_t i = 0; i < num_proofs; ++i) {
+        auto builder = UltraBuilder();
+        bench_utils::generate_basic_arithmetic_circuit(builder, 1 << 12);
+        auto composer = UltraHonk();
+        auto instance = composer.create_instance(builder);
+        auto prover = composer.create_prover(instance);
+        proofs.emplace_back(prover.construct_proof());
+        if (i == 0) {
+            verifier.emplace(composer.create_verifier(instance));
+        }
+    }
+
+    for (auto _ : state) {
+        if (accumulate) {
+            DoNotOptimize(verifier->verify_proofs(proofs));
+        } else {
+            for (const auto& proof : proofs) {
+                DoNotOptimize(verifier->verify_proof(proof));
+            }
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(num_proofs));
+}
+
 // Define benchmarks
+BENCHMARK_CAPTURE(verify_proofs_ultra, individually, false)
+    ->RangeMultiplier(4)
+    ->Range(1, 64)
+    ->Unit(::benchmark::kMillisecond);
+BENCHMARK_CAPTURE(verify_proofs_ultra, accumulated, true)
+    ->RangeMultiplier(4)
+    ->Range(1, 64)
+    ->Unit(::benchmark::kMillisecond);
+BENCHMARK_CAPTURE(construct_instance_ultra, sha256, &bench_utils::generate_sha256_test_circuit<UltraBuilder>)
+    ->DenseRange(MIN_NUM_ITERATIONS, MAX_NUM_ITERATIONS)
+    ->Unit(::benchmark::kMillisecond);
+BENCHMARK_CAPTURE(construct_instance_ultra, keccak, &bench_utils::generate_keccak_test_circuit<UltraBuilder>)
+    ->DenseRange(MIN_NUM_ITERATIONS, MAX_NUM_ITERATIONS)
+    ->Unit(::benchmark::kMillisecond);
 BENCHMARK_CAPTURE(construct_proof_ultra, sha256, &bench_utils::generate_sha256_test_circuit<UltraBuilder>)
     ->DenseRange(MIN_NUM_ITERATIONS, MAX_NUM_ITERATIONS)
     ->Repetitions(NUM_REPETITIONS)
@@ -76,6 +76,39 @@ int pippenger()
     return 0;
 }
 
+/**
+ * Verifier-sized MSMs, which pippenger hands to small_msm below SMALL_MSM_THRESHOLD points, against pippenger's bucket
+ * method on the same points.
+ */
+int small_msms()
+{
+    for (size_t num_points = 8; num_points <= 512; num_points *= 2) {
+        constexpr int64_t NUM_REPETITIONS = 16;
+        scalar_multiplication::pippenger_runtime_state<curve::BN254> state(num_points);
+        std::vector<fr> scalar_copy(num_points);
+
+        std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
+        for (int64_t i = 0; i < NUM_REPETITIONS; ++i) {
+            scalar_multiplication::pippenger<curve::BN254>(
+                &scalars[0], reference_string->get_monomial_points(), num_points, state);
+        }
+        std::chrono::steady_clock::time_point time_mid = std::chrono::steady_clock::now();
+        for (int64_t i = 0; i < NUM_REPETITIONS; ++i) {
+            // pippenger_internal overwrites the scalars.
+            std::copy_n(&scalars[0], num_points, &scalar_copy[0]);
+            scalar_multiplication::pippenger_internal<curve::BN254>(
+                reference_string->get_monomial_points(), &scalar_copy[0], num_points, state, true);
+        }
+        std::chrono::steady_clock::time_point time_end = std::chrono::steady_clock::now();
+
+        auto dispatched = std::chrono::duration_cast<std::chrono::microseconds>(time_mid - time_start);
+        auto bucketed = std::chrono::duration_cast<std::chrono::microseconds>(time_end - time_mid);
+        std::cout << num_points << " points: pippenger " << dispatched.count() / NUM_REPETITIONS
+                  << "us, bucket method " << bucketed.count() / NUM_REPETITIONS << "us" << std::endl;
+    }
+    return 0;
+}
+
 int coset_fft_split()
 {
     std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
@@ -104,6 +137,8 @@ int main()
     coset_fft_regular();
     std::cout << "executing sliced fft" << std::endl;
     coset_fft_split();
+    std::cout << "executing small msms" << std::endl;
+    small_msms();
     std::cout << "executing pippenger algorithm" << std::endl;
     pippenger();
     pippenger();
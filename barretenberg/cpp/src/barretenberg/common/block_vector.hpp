@@ -0,0 +1,295 @@
+#pragma once
+#include "./slab_allocator.hpp"
+#include <algorithm>
+#include <compare>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace barretenberg {
+
+/**
+ * A vector of trivially copyable values which doesn't move its values as it grows, for the columns of gates which
+ * circuit builders append to.
+ *
+ * The values live in a contiguous head followed by blocks of a fixed size, all taken from the slab allocator. The head
+ * grows as a std::vector does until it holds a block's worth of values, or to the size given to reserve, and appending
+ * beyond it takes a new block instead of reallocating and copying everything so far. make_contiguous merges the blocks
+ * into the head once the vector is complete, so a vector reserved to its final size never copies its values.
+ */
+template <typename T, size_t LOG_BLOCK_SIZE = 16> class BlockVector {
+    static_assert(std::is_trivially_copyable_v<T>);
+
+  public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    static constexpr size_t BLOCK_SIZE = 1UL << LOG_BLOCK_SIZE;
+
+    template <bool IS_CONST> class Iterator {
+      public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IS_CONST, const T*, T*>;
+        using reference = std::conditional_t<IS_CONST, const T&, T&>;
+        using container = std::conditional_t<IS_CONST, const BlockVector, BlockVector>;
+
+        Iterator() = default;
+        Iterator(container* vector, size_t index)
+            : vector_(vector)
+            , index_(index)
+        {}
+        reference operator*() const { return (*vector_)[index_]; }
+        pointer operator->() const { return &(*vector_)[index_]; }
+        reference operator[](difference_type offset) const { return *(*this + offset); }
+        Iterator& operator++()
+        {
+            ++index_;
+            return *this;
+        }
+        Iterator operator++(int)
+        {
+            Iterator result = *this;
+            ++index_;
+            return result;
+        }
+        Iterator& operator--()
+        {
+            --index_;
+            return *this;
+        }
+        Iterator operator--(int)
+        {
+            Iterator result = *this;
+            --index_;
+            return result;
+        }
+        Iterator& operator+=(difference_type offset)
+        {
+            index_ = static_cast<size_t>(static_cast<difference_type>(index_) + offset);
+            return *this;
+        }
+        Iterator& operator-=(difference_type offset) { return *this += -offset; }
+        friend Iterator operator+(Iterator it, difference_type offset) { return it += offset; }
+        friend Iterator operator+(difference_type offset, Iterator it) { return it += offset; }
+        friend Iterator operator-(Iterator it, difference_type offset) { return it -= offset; }
+        friend difference_type operator-(const Iterator& lhs, const Iterator& rhs)
+        {
+            return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+        }
+        friend bool operator==(const Iterator& lhs, const Iterator& rhs) { return lhs.index_ == rhs.index_; }
+        friend auto operator<=>(const Iterator& lhs, const Iterator& rhs) { return lhs.index_ <=> rhs.index_; }
+
+      private:
+        container* vector_ = nullptr;
+        size_t index_ = 0;
+    };
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    BlockVector() = default;
+    BlockVector(const size_t count, const T& value = T()) { resize(count, value); }
+    BlockVector(std::initializer_list<T> values) { *this = values; }
+    BlockVector(const BlockVector& other) { *this = other; }
+    BlockVector(BlockVector&& other) noexcept { *this = std::move(other); }
+    ~BlockVector() = default;
+
+    BlockVector& operator=(const BlockVector& other)
+    {
+        if (this == &other) {
+            return *this;
+        }
+        clear();
+        reserve(other.size_);
+        other.for_each_segment(0, other.size_, [&](const T* values, size_t start, size_t count) {
+            std::memcpy(static_cast<void*>(head_data_ + start), static_cast<const void*>(values), count * sizeof(T));
+        });
+        size_ = other.size_;
+        return *this;
+    }
+
+    BlockVector& operator=(BlockVector&& other) noexcept
+    {
+        head_ = std::move(other.head_);
+        head_data_ = std::exchange(other.head_data_, nullptr);
+        head_capacity_ = std::exchange(other.head_capacity_, 0);
+        blocks_ = std::move(other.blocks_);
+        block_data_ = std::move(other.block_data_);
+        size_ = std::exchange(other.size_, 0);
+        other.blocks_.clear();
+        other.block_data_.clear();
+        return *this;
+    }
+
+    BlockVector& operator=(std::initializer_list<T> values)
+    {
+        clear();
+        reserve(values.size());
+        std::copy(values.begin(), values.end(), head_data_);
+        size_ = values.size();
+        return *this;
+    }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    size_t capacity() const { return head_capacity_ + block_data_.size() * BLOCK_SIZE; }
+
+    T& operator[](const size_t index) { return *slot(index); }
+    const T& operator[](const size_t index) const { return *const_cast<BlockVector*>(this)->slot(index); }
+    T& front() { return (*this)[0]; }
+    const T& front() const { return (*this)[0]; }
+    T& back() { return (*this)[size_ - 1]; }
+    const T& back() const { return (*this)[size_ - 1]; }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, size_); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, size_); }
+
+    template <typename... Args> T& emplace_back(Args&&... args)
+    {
+        // The arguments may refer to a value which growing moves
+        const T value = T(std::forward<Args>(args)...);
+        if (size_ == capacity()) {
+            grow();
+        }
+        T* result = slot(size_);
+        *result = value;
+        ++size_;
+        return *result;
+    }
+    void push_back(const T& value) { emplace_back(value); }
+    void pop_back() { --size_; }
+    void clear() { size_ = 0; }
+
+    /**
+     * @brief Make room for new_capacity values in the head, so that they are contiguous
+     */
+    void reserve(const size_t new_capacity)
+    {
+        if (new_capacity <= head_capacity_) {
+            return;
+        }
+        set_head_capacity(std::max(new_capacity, size_));
+    }
+
+    void resize(const size_t new_size, const T& value = T())
+    {
+        while (new_size > capacity()) {
+            grow();
+        }
+        if (new_size > size_) {
+            for_each_segment(size_, new_size, [&](T* values, size_t /*unused*/, size_t count) {
+                std::fill(values, values + count, value);
+            });
+        }
+        size_ = new_size;
+    }
+
+    bool is_contiguous() const { return block_data_.empty() || size_ <= head_capacity_; }
+
+    /**
+     * @brief Move the values in blocks into the head, and return the values as one span
+     */
+    std::span<T> make_contiguous()
+    {
+        if (!is_contiguous()) {
+            set_head_capacity(size_);
+        }
+        return { head_data_, size_ };
+    }
+
+    /**
+     * @brief Copy the values to the destination, a run of contiguous values at a time
+     */
+    void copy_to(T* destination) const
+    {
+        for_each_segment(0, size_, [&](const T* values, size_t start, size_t count) {
+            std::memcpy(static_cast<void*>(destination + start), static_cast<const void*>(values), count * sizeof(T));
+        });
+    }
+
+    friend bool operator==(const BlockVector& lhs, const BlockVector& rhs)
+    {
+        if (lhs.size_ != rhs.size_) {
+            return false;
+        }
+        for (size_t i = 0; i < lhs.size_; ++i) {
+            if (!(lhs[i] == rhs[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+  private:
+    static constexpr size_t BLOCK_MASK = BLOCK_SIZE - 1;
+
+    T* slot(const size_t index)
+    {
+        if (index < head_capacity_) {
+            return head_data_ + index;
+        }
+        const size_t block_index = index - head_capacity_;
+        return block_data_[block_index >> LOG_BLOCK_SIZE] + (block_index & BLOCK_MASK);
+    }
+
+    // Call fn(values, start, count) on each contiguous run of the values with indices in [start, end)
+    template <typename Fn> void for_each_segment(size_t start, const size_t end, Fn&& fn) const
+    {
+        while (start < end) {
+            const size_t run = start < head_capacity_
+                                   ? std::min(end, head_capacity_) - start
+                                   : std::min(end - start, BLOCK_SIZE - ((start - head_capacity_) & BLOCK_MASK));
+            fn(const_cast<BlockVector*>(this)->slot(start), start, run);
+            start += run;
+        }
+    }
+
+    void grow()
+    {
+        if (block_data_.empty() && head_capacity_ < BLOCK_SIZE) {
+            set_head_capacity(std::max(std::min(2 * head_capacity_, BLOCK_SIZE), size_t(16)));
+        } else {
+            add_block();
+        }
+    }
+
+    void add_block()
+    {
+        blocks_.emplace_back(get_mem_slab(BLOCK_SIZE * sizeof(T)));
+        block_data_.emplace_back(static_cast<T*>(blocks_.back().get()));
+    }
+
+    // Replace the head with one of the given capacity, holding all of the values, and drop the blocks
+    void set_head_capacity(const size_t new_capacity)
+    {
+        std::shared_ptr<void> new_head = get_mem_slab(new_capacity * sizeof(T));
+        T* new_head_data = static_cast<T*>(new_head.get());
+        for_each_segment(0, size_, [&](const T* values, size_t start, size_t count) {
+            std::memcpy(static_cast<void*>(new_head_data + start), static_cast<const void*>(values), count * sizeof(T));
+        });
+        head_ = std::move(new_head);
+        head_data_ = new_head_data;
+        head_capacity_ = new_capacity;
+        blocks_.clear();
+        block_data_.clear();
+    }
+
+    std::shared_ptr<void> head_;
+    T* head_data_ = nullptr;
+    size_t head_capacity_ = 0;
+    std::vector<std::shared_ptr<void>> blocks_;
+    std::vector<T*> block_data_;
+    size_t size_ = 0;
+};
+
+} // namespace barretenberg
@@ -0,0 +1,94 @@
+#include "memory_policy.hpp"
+#include "log.hpp"
+#include "thread.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#ifdef BB_LIBNUMA
+#include <numa.h>
+#endif
+
+namespace barretenberg {
+
+namespace {
+
+constexpr size_t PAGE_SIZE = 4096;
+// Below this, the cost of a parallel_for outweighs any gain.
+constexpr size_t MIN_PARALLEL_ZERO_SIZE = 1UL << 20;
+
+std::atomic<MemoryPolicy> memory_policy = MemoryPolicy::FIRST_TOUCH;
+
+/**
+ * @brief Interleave the whole pages of the buffer across all NUMA nodes, returning false if that isn't possible.
+ */
+bool interleave_pages([[maybe_unused]] void* buffer, [[maybe_unused]] size_t size)
+{
+#ifdef BB_LIBNUMA
+    static const bool numa_supported = numa_available() != -1;
+    if (!numa_supported) {
+        return false;
+    }
+    const auto begin = (reinterpret_cast<uintptr_t>(buffer) + PAGE_SIZE - 1) & ~(PAGE_SIZE - 1);
+    const auto end = (reinterpret_cast<uintptr_t>(buffer) + size) & ~(PAGE_SIZE - 1);
+    if (begin < end) {
+        numa_interleave_memory(reinterpret_cast<void*>(begin), end - begin, numa_all_nodes_ptr);
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+} // namespace
+
+void set_memory_policy(MemoryPolicy policy)
+{
+    if (policy == MemoryPolicy::INTERLEAVE && !interleave_pages(nullptr, 0)) {
+        info("NUMA interleaving is unavailable, falling back to first-touch placement.");
+    }
+    memory_policy = policy;
+}
+
+MemoryPolicy get_memory_policy()
+{
+    return memory_policy;
+}
+
+std::optional<MemoryPolicy> parse_memory_policy(std::string const& name)
+{
+    if (name == "serial") {
+        return MemoryPolicy::SERIAL;
+    }
+    if (name == "first-touch") {
+        return MemoryPolicy::FIRST_TOUCH;
+    }
+    if (name == "interleave") {
+        return MemoryPolicy::INTERLEAVE;
+    }
+    return std::nullopt;
+}
+
+void zero_new_memory(void* buffer, size_t size)
+{
+    const MemoryPolicy policy = memory_policy;
+    if (policy == MemoryPolicy::SERIAL || size < MIN_PARALLEL_ZERO_SIZE || in_parallel_for()) {
+        memset(buffer, 0, size);
+        return;
+    }
+    if (policy == MemoryPolicy::INTERLEAVE) {
+        interleave_pages(buffer, size);
+    }
+
+    // Split at page boundaries, so that each page is first touched by the thread whose chunk holds it.
+    auto* bytes = static_cast<uint8_t*>(buffer);
+    const size_t num_threads = get_num_cpus();
+    const size_t num_pages = (size + PAGE_SIZE - 1) / PAGE_SIZE;
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = std::min(((thread_idx * num_pages) / num_threads) * PAGE_SIZE, size);
+        const size_t end = std::min((((thread_idx + 1) * num_pages) / num_threads) * PAGE_SIZE, size);
+        memset(bytes + start, 0, end - start);
+    });
+}
+
+} // namespace barretenberg
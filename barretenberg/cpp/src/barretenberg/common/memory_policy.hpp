@@ -0,0 +1,43 @@
+#pragma once
+#include <cstddef>
+#include <optional>
+#include <string>
+
+/**
+ * Placement of the pages of large buffers (polynomials, pippenger point tables) across NUMA nodes.
+ *
+ * Linux places a page on the NUMA node of the thread which first touches it. Zeroing a buffer from the allocating
+ * thread therefore puts all of it on one socket, and threads on the other sockets pay for remote accesses to it for
+ * as long as it lives. Buffers zeroed with zero_new_memory are instead touched by the threads of a parallel_for, in
+ * the contiguous equal chunks which the parallel algorithms (FFTs, pippenger) split their work into.
+ */
+namespace barretenberg {
+
+enum class MemoryPolicy {
+    // Zero buffers from the allocating thread, as a plain memset does.
+    SERIAL,
+    // Zero each chunk of a buffer from the thread of a parallel_for which processes it.
+    FIRST_TOUCH,
+    // Interleave the pages of buffers across all NUMA nodes with libnuma, then zero them as for FIRST_TOUCH. Falls back
+    // to FIRST_TOUCH when built without libnuma (-DENABLE_LIBNUMA=ON) or when the system doesn't support NUMA.
+    INTERLEAVE,
+};
+
+/**
+ * @brief Set the process-wide policy for buffers allocated from now on. The default is FIRST_TOUCH.
+ */
+void set_memory_policy(MemoryPolicy policy);
+MemoryPolicy get_memory_policy();
+
+/**
+ * @brief Parse "serial", "first-touch" or "interleave".
+ */
+std::optional<MemoryPolicy> parse_memory_policy(std::string const& name);
+
+/**
+ * @brief Zero a newly allocated buffer, placing its pages according to the memory policy. Buffers smaller than a
+ * megabyte are always zeroed serially, as are those allocated within a parallel_for.
+ */
+void zero_new_memory(void* buffer, size_t size);
+
+} // namespace barretenberg
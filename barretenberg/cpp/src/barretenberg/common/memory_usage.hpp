@@ -0,0 +1,57 @@
+#pragma once
+#include <cstddef>
+#include <fstream>
+#include <string>
+#ifndef __wasm__
+#include <sys/resource.h>
+#endif
+
+namespace barretenberg {
+
+/**
+ * @brief Get the peak resident set size of this process in bytes, or 0 if it cannot be determined.
+ * @details On Linux this reads the high water mark (VmHWM) from /proc, which honours reset_peak_rss(). Elsewhere we fall
+ * back to getrusage, whose peak can't be reset.
+ */
+inline size_t get_peak_rss_bytes()
+{
+#if defined(__linux__)
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.rfind("VmHWM:", 0) == 0) {
+            // Formatted as e.g. "VmHWM:     1234 kB".
+            return std::stoul(line.substr(6)) * 1024;
+        }
+    }
+#endif
+#ifndef __wasm__
+    struct rusage usage {};
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#ifdef __APPLE__
+        // ru_maxrss is in bytes on macOS, kilobytes on Linux.
+        return static_cast<size_t>(usage.ru_maxrss);
+#else
+        return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+    }
+#endif
+    return 0;
+}
+
+/**
+ * @brief Reset the peak resident set size to the current resident set size, so that a subsequent
+ * get_peak_rss_bytes() measures the peak of a single workload. Returns false if unsupported on this platform.
+ */
+inline bool reset_peak_rss()
+{
+#if defined(__linux__)
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    clear_refs << "5";
+    return clear_refs.good();
+#else
+    return false;
+#endif
+}
+
+} // namespace barretenberg
@@ -68,6 +68,24 @@ void parallel_for_atomic_pool(size_t num_iterations, const std::function<void(si
 
 void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
 
+namespace {
+thread_local bool is_parallel_for_iteration = false;
+
+struct ParallelForIteration {
+    ParallelForIteration() { is_parallel_for_iteration = true; }
+    ~ParallelForIteration() { is_parallel_for_iteration = false; }
+    ParallelForIteration(const ParallelForIteration&) = delete;
+    ParallelForIteration(ParallelForIteration&&) = delete;
+    ParallelForIteration& operator=(const ParallelForIteration&) = delete;
+    ParallelForIteration& operator=(ParallelForIteration&&) = delete;
+};
+} // namespace
+
+bool in_parallel_for()
+{
+    return is_parallel_for_iteration;
+}
+
 void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func)
 {
 #ifdef NO_MULTITHREADING
@@ -75,14 +93,24 @@ void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func
         func(i);
     }
 #else
+    if (is_parallel_for_iteration) {
+        for (size_t i = 0; i < num_iterations; ++i) {
+            func(i);
+        }
+        return;
+    }
+    const std::function<void(size_t)> iteration = [&](size_t i) {
+        ParallelForIteration scope;
+        func(i);
+    };
 #ifndef NO_OMP_MULTITHREADING
-    parallel_for_omp(num_iterations, func);
+    parallel_for_omp(num_iterations, iteration);
 #else
-    // parallel_for_spawning(num_iterations, func);
-    // parallel_for_moody(num_iterations, func);
-    // parallel_for_atomic_pool(num_iterations, func);
-    parallel_for_mutex_pool(num_iterations, func);
-    // parallel_for_queued(num_iterations, func);
+    // parallel_for_spawning(num_iterations, iteration);
+    // parallel_for_moody(num_iterations, iteration);
+    // parallel_for_atomic_pool(num_iterations, iteration);
+    parallel_for_mutex_pool(num_iterations, iteration);
+    // parallel_for_queued(num_iterations, iteration);
 #endif
 #endif
 }
@@ -21,4 +21,10 @@ inline size_t get_num_cpus_pow2()
     return static_cast<size_t>(1ULL << numeric::get_msb(get_num_cpus()));
 }
 
-void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func);
\ No newline at end of file
+void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func);
+
+/**
+ * @brief Whether the calling thread is running an iteration of a parallel_for. A parallel_for started from within one
+ * runs its iterations serially on the calling thread, as the thread pools aren't reentrant.
+ */
+bool in_parallel_for();
\ No newline at end of file
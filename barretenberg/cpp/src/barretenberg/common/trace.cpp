@@ -0,0 +1,185 @@
+#include "trace.hpp"
+#include <atomic>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace barretenberg::trace {
+
+namespace {
+
+struct Span {
+    const char* name;
+    int64_t start_ns;
+    int64_t duration_ns;
+    size_t elements;
+    size_t bytes;
+};
+
+// Spans are buffered per thread, so recording never contends. Buffers are owned by the registry rather than by the
+// thread, as the worker threads of parallel_for may exit before the trace is written.
+struct ThreadBuffer {
+    uint32_t thread_id;
+    std::vector<Span> spans;
+};
+
+struct Registry {
+#ifndef NO_MULTITHREADING
+    std::mutex mutex;
+#endif
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+};
+
+std::atomic<bool> recording_enabled = false;
+
+Registry& get_registry()
+{
+    static Registry registry;
+    return registry;
+}
+
+ThreadBuffer& get_thread_buffer()
+{
+    thread_local ThreadBuffer* buffer = nullptr;
+    if (buffer == nullptr) {
+        auto& registry = get_registry();
+#ifndef NO_MULTITHREADING
+        std::lock_guard<std::mutex> lock(registry.mutex);
+#endif
+        registry.buffers.push_back(std::make_unique<ThreadBuffer>());
+        buffer = registry.buffers.back().get();
+        buffer->thread_id = static_cast<uint32_t>(registry.buffers.size());
+    }
+    return *buffer;
+}
+
+void write_json_string(std::ostream& os, const char* str)
+{
+    os << '"';
+    for (const char* c = str; *c != '\0'; ++c) {
+        if (*c == '"' || *c == '\\') {
+            os << '\\';
+        }
+        os << *c;
+    }
+    os << '"';
+}
+
+} // namespace
+
+void start_recording()
+{
+    // Construct the registry up front, so that its epoch precedes the first span.
+    get_registry();
+    recording_enabled.store(true, std::memory_order_relaxed);
+}
+
+void stop_recording()
+{
+    recording_enabled.store(false, std::memory_order_relaxed);
+}
+
+bool is_recording()
+{
+    return recording_enabled.load(std::memory_order_relaxed);
+}
+
+// Not safe to call while spans are being recorded on other threads.
+void clear()
+{
+    auto& registry = get_registry();
+#ifndef NO_MULTITHREADING
+    std::lock_guard<std::mutex> lock(registry.mutex);
+#endif
+    for (auto& buffer : registry.buffers) {
+        buffer->spans.clear();
+    }
+}
+
+std::map<std::string, StageTotal> stage_totals()
+{
+    auto& registry = get_registry();
+#ifndef NO_MULTITHREADING
+    std::lock_guard<std::mutex> lock(registry.mutex);
+#endif
+    std::map<std::string, StageTotal> totals;
+    for (auto& buffer : registry.buffers) {
+        for (auto& span : buffer->spans) {
+            auto& total = totals[span.name];
+            total.count++;
+            total.total_ns += span.duration_ns;
+            total.elements += span.elements;
+            total.bytes += span.bytes;
+        }
+    }
+    return totals;
+}
+
+void write_chrome_trace(std::ostream& os)
+{
+    auto& registry = get_registry();
+#ifndef NO_MULTITHREADING
+    std::lock_guard<std::mutex> lock(registry.mutex);
+#endif
+
+    os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    for (auto& buffer : registry.buffers) {
+        for (auto& span : buffer->spans) {
+            os << (first ? "\n" : ",\n");
+            first = false;
+            // Chrome trace timestamps are in (fractional) microseconds.
+            os << "{\"name\":";
+            write_json_string(os, span.name);
+            os << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->thread_id
+               << ",\"ts\":" << static_cast<double>(span.start_ns) / 1000.0
+               << ",\"dur\":" << static_cast<double>(span.duration_ns) / 1000.0;
+            if (span.elements != 0 || span.bytes != 0) {
+                os << ",\"args\":{\"elements\":" << span.elements << ",\"bytes\":" << span.bytes << "}";
+            }
+            os << "}";
+        }
+    }
+    os << "\n]}\n";
+}
+
+bool write_chrome_trace(std::string const& path)
+{
+    std::ofstream file(path);
+    if (!file) {
+        return false;
+    }
+    write_chrome_trace(file);
+    return file.good();
+}
+
+ScopedSpan::ScopedSpan(const char* name, size_t elements, size_t bytes)
+    : name(name)
+    , elements(elements)
+    , bytes(bytes)
+    , recording(is_recording())
+{
+    if (recording) {
+        start = std::chrono::steady_clock::now();
+    }
+}
+
+ScopedSpan::~ScopedSpan()
+{
+    if (!recording) {
+        return;
+    }
+    auto end = std::chrono::steady_clock::now();
+    auto& epoch = get_registry().epoch;
+    get_thread_buffer().spans.push_back({
+        .name = name,
+        .start_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(start - epoch).count(),
+        .duration_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count(),
+        .elements = elements,
+        .bytes = bytes,
+    });
+}
+
+} // namespace barretenberg::trace
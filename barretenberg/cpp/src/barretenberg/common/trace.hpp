@@ -0,0 +1,100 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+
+/**
+ * Scoped, hierarchical tracing of prover stages.
+ *
+ * Spans are opened with BB_TRACE_SCOPE("name") (or BB_TRACE_SCOPE_COUNTS("name", elements, bytes)) and closed at the
+ * end of the enclosing scope. Nesting is implied by time containment on a thread, which is how the Chrome trace viewer
+ * (chrome://tracing) and Perfetto (ui.perfetto.dev) render "complete" events.
+ *
+ * Tracing is compiled in only when configured with -DENABLE_TRACING=ON (which defines BB_TRACE). Otherwise the macros
+ * expand to nothing and their arguments are not evaluated. When compiled in, spans are only recorded between
+ * trace::start_recording() and trace::stop_recording(); outside that window a span costs one relaxed atomic load.
+ *
+ * e.g.
+ * ```
+ *     BB_TRACE_SCOPE_COUNTS("pippenger", num_points, num_points * sizeof(g1::affine_element));
+ * ```
+ */
+namespace barretenberg::trace {
+
+/**
+ * @brief Whether tracing support was compiled in.
+ */
+constexpr bool compiled_in()
+{
+#ifdef BB_TRACE
+    return true;
+#else
+    return false;
+#endif
+}
+
+void start_recording();
+void stop_recording();
+bool is_recording();
+
+/**
+ * @brief Discard all spans recorded so far.
+ */
+void clear();
+
+struct StageTotal {
+    size_t count = 0;
+    int64_t total_ns = 0;
+    size_t elements = 0;
+    size_t bytes = 0;
+};
+
+/**
+ * @brief Sum the recorded spans by name, across all threads.
+ */
+std::map<std::string, StageTotal> stage_totals();
+
+/**
+ * @brief Write all recorded spans in the Chrome trace event JSON format (also accepted by Perfetto).
+ */
+void write_chrome_trace(std::ostream& os);
+bool write_chrome_trace(std::string const& path);
+
+/**
+ * @brief RAII span. Use the BB_TRACE_SCOPE macros rather than instantiating directly.
+ * @details `name` must outlive the trace (i.e. be a string literal).
+ */
+class ScopedSpan {
+  public:
+    explicit ScopedSpan(const char* name, size_t elements = 0, size_t bytes = 0);
+    ~ScopedSpan();
+
+    ScopedSpan(const ScopedSpan&) = delete;
+    ScopedSpan(ScopedSpan&&) = delete;
+    ScopedSpan& operator=(const ScopedSpan&) = delete;
+    ScopedSpan& operator=(ScopedSpan&&) = delete;
+
+  private:
+    const char* name;
+    size_t elements;
+    size_t bytes;
+    bool recording;
+    std::chrono::steady_clock::time_point start;
+};
+
+} // namespace barretenberg::trace
+
+#ifdef BB_TRACE
+#define BB_TRACE_CONCAT_INNER(a, b) a##b
+#define BB_TRACE_CONCAT(a, b) BB_TRACE_CONCAT_INNER(a, b)
+#define BB_TRACE_SCOPE(name) barretenberg::trace::ScopedSpan BB_TRACE_CONCAT(_bb_trace_span_, __LINE__)(name)
+#define BB_TRACE_SCOPE_COUNTS(name, elements, bytes)                                                                   \
+    barretenberg::trace::ScopedSpan BB_TRACE_CONCAT(_bb_trace_span_, __LINE__)(                                        \
+        name, static_cast<size_t>(elements), static_cast<size_t>(bytes))
+#else
+#define BB_TRACE_SCOPE(name)
+#define BB_TRACE_SCOPE_COUNTS(name, elements, bytes)
+#endif
@@ -1,5 +1,6 @@
 #include "acir_format.hpp"
 #include "barretenberg/common/log.hpp"
+#include "barretenberg/common/trace.hpp"
 
 namespace acir_format {
 
@@ -13,6 +14,7 @@ void read_witness(Builder& builder, WitnessVector const& witness)
 
 void create_circuit(Builder& builder, acir_format const& constraint_system)
 {
+    BB_TRACE_SCOPE_COUNTS("acir_format::create_circuit", constraint_system.varnum, 0);
     if (constraint_system.public_inputs.size() > constraint_system.varnum) {
         info("create_circuit: too many public inputs!");
     }
@@ -131,6 +133,7 @@ Builder create_circuit_with_witness(acir_format const& constraint_system,
 
 void create_circuit_with_witness(Builder& builder, acir_format const& constraint_system, WitnessVector const& witness)
 {
+    BB_TRACE_SCOPE_COUNTS("acir_format::create_circuit_with_witness", constraint_system.varnum, 0);
     if (constraint_system.public_inputs.size() > constraint_system.varnum) {
         info("create_circuit_with_witness: too many public inputs!");
     }
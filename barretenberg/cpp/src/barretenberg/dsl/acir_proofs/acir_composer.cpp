@@ -48,6 +48,7 @@ void AcirComposer::init_proving_key(
     circuit_subgroup_size_ = builder_.get_circuit_subgroup_size(total_circuit_size_);
 
     composer_ = acir_format::Composer(crs_factory);
+    composer_.set_memory_budget(memory_budget_);
     vinfo("computing proving key...");
     proving_key_ = composer_.compute_proving_key(builder_);
 }
@@ -75,6 +76,7 @@ std::vector<uint8_t> AcirComposer::create_proof(
             return acir_format::Composer(crs_factory);
         }
     }();
+    composer_.set_memory_budget(memory_budget_);
     if (!proving_key_) {
         vinfo("computing proving key...");
         proving_key_ = composer_.compute_proving_key(builder_);
@@ -137,6 +139,43 @@ bool AcirComposer::verify_proof(std::vector<uint8_t> const& proof, bool is_recur
     }
 }
 
+void AcirComposer::accumulate_proof(std::vector<uint8_t> const& proof, bool is_recursive)
+{
+    (is_recursive ? accumulated_recursive_proofs_ : accumulated_proofs_).push_back({ proof });
+}
+
+bool AcirComposer::verify_accumulated_proofs()
+{
+    if (!verification_key_) {
+        vinfo("computing verification key...");
+        verification_key_ = composer_.compute_verification_key(builder_);
+        vinfo("done.");
+    }
+
+    auto proofs = std::move(accumulated_proofs_);
+    auto recursive_proofs = std::move(accumulated_recursive_proofs_);
+    accumulated_proofs_.clear();
+    accumulated_recursive_proofs_.clear();
+
+    // As in verify_proof. The proofs are all of the same circuit, so they have the same number of public inputs.
+    const auto resize_public_inputs = [&](std::vector<proof_system::plonk::proof> const& queued) {
+        builder_.public_inputs.resize((queued[0].proof_data.size() - 2144) / 32);
+    };
+
+    bool verified = true;
+    if (!recursive_proofs.empty()) {
+        resize_public_inputs(recursive_proofs);
+        auto verifier = composer_.create_verifier(builder_);
+        verified = verified && verifier.verify_proofs(recursive_proofs);
+    }
+    if (!proofs.empty()) {
+        resize_public_inputs(proofs);
+        auto verifier = composer_.create_ultra_with_keccak_verifier(builder_);
+        verified = verified && verifier.verify_proofs(proofs);
+    }
+    return verified;
+}
+
 std::string AcirComposer::get_solidity_verifier()
 {
     std::ostringstream stream;
@@ -1,10 +1,12 @@
 #pragma once
 #include <barretenberg/dsl/acir_format/acir_format.hpp>
 #include <barretenberg/plonk/proof_system/proving_key/proving_key.hpp>
+#include <barretenberg/plonk/proof_system/types/proof.hpp>
 #include <barretenberg/plonk/proof_system/verification_key/verification_key.hpp>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace acir_proofs {
 
@@ -14,6 +16,12 @@ class AcirComposer {
 
     void create_circuit(acir_format::acir_format& constraint_system);
 
+    /**
+     * @brief Bound the memory held by the proving key's polynomials (bytes, 0 for unbounded). See
+     * UltraComposer::set_memory_budget.
+     */
+    void set_memory_budget(size_t bytes) { memory_budget_ = bytes; }
+
     void init_proving_key(std::shared_ptr<barretenberg::srs::factories::CrsFactory<curve::BN254>> const& crs_factory,
                           acir_format::acir_format& constraint_system);
 
@@ -31,6 +39,17 @@ class AcirComposer {
 
     bool verify_proof(std::vector<uint8_t> const& proof, bool is_recursive);
 
+    /**
+     * @brief Queue a proof to be checked by verify_accumulated_proofs.
+     */
+    void accumulate_proof(std::vector<uint8_t> const& proof, bool is_recursive);
+
+    /**
+     * @brief Verify all of the proofs queued by accumulate_proof, with one pairing for each kind of proof (recursive or
+     * not), and clear the queue. See VerifierBase::verify_proofs.
+     */
+    bool verify_accumulated_proofs();
+
     std::string get_solidity_verifier();
     size_t get_exact_circuit_size() { return exact_circuit_size_; };
     size_t get_total_circuit_size() { return total_circuit_size_; };
@@ -50,6 +69,9 @@ class AcirComposer {
     std::shared_ptr<proof_system::plonk::proving_key> proving_key_;
     std::shared_ptr<proof_system::plonk::verification_key> verification_key_;
     bool verbose_ = true;
+    size_t memory_budget_ = 0;
+    std::vector<proof_system::plonk::proof> accumulated_proofs_;
+    std::vector<proof_system::plonk::proof> accumulated_recursive_proofs_;
 
     template <typename... Args> inline void vinfo(Args... args)
     {
@@ -84,6 +84,19 @@ WASM_EXPORT void acir_verify_proof(in_ptr acir_composer_ptr,
     *result = acir_composer->verify_proof(proof, *is_recursive);
 }
 
+WASM_EXPORT void acir_accumulate_proof(in_ptr acir_composer_ptr, uint8_t const* proof_buf, bool const* is_recursive)
+{
+    auto acir_composer = reinterpret_cast<acir_proofs::AcirComposer*>(*acir_composer_ptr);
+    auto proof = from_buffer<std::vector<uint8_t>>(proof_buf);
+    acir_composer->accumulate_proof(proof, *is_recursive);
+}
+
+WASM_EXPORT void acir_verify_accumulated_proofs(in_ptr acir_composer_ptr, bool* result)
+{
+    auto acir_composer = reinterpret_cast<acir_proofs::AcirComposer*>(*acir_composer_ptr);
+    *result = acir_composer->verify_accumulated_proofs();
+}
+
 WASM_EXPORT void acir_get_solidity_verifier(in_ptr acir_composer_ptr, out_str_buf out)
 {
     auto acir_composer = reinterpret_cast<acir_proofs::AcirComposer*>(*acir_composer_ptr);
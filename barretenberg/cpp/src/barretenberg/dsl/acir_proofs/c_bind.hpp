@@ -43,6 +43,14 @@ WASM_EXPORT void acir_verify_proof(in_ptr acir_composer_ptr,
                                    bool const* is_recursive,
                                    bool* result);
 
+/**
+ * Queue a proof to be checked by acir_verify_accumulated_proofs, which checks all of the queued proofs at once, with a
+ * single pairing.
+ */
+WASM_EXPORT void acir_accumulate_proof(in_ptr acir_composer_ptr, uint8_t const* proof_buf, bool const* is_recursive);
+
+WASM_EXPORT void acir_verify_accumulated_proofs(in_ptr acir_composer_ptr, bool* result);
+
 WASM_EXPORT void acir_get_solidity_verifier(in_ptr acir_composer_ptr, out_str_buf out);
 
 WASM_EXPORT void acir_serialize_proof_into_fields(in_ptr acir_composer_ptr,
@@ -1,5 +1,6 @@
 #include "fr.hpp"
 #include <benchmark/benchmark.h>
+#include <vector>
 
 using namespace benchmark;
 
@@ -436,5 +437,107 @@ void pow_bench(State& state) noexcept
 }
 BENCHMARK(pow_bench);
 
+/**
+ * The batch operations, against the equivalent loops of scalar operations. Reports elements/s: on CPUs with AVX-512
+ * IFMA the batch multiplications process 8 elements per kernel call.
+ */
+struct BatchInputs {
+    std::vector<fr> a;
+    std::vector<fr> b;
+    std::vector<fr> out;
+    explicit BatchInputs(size_t n)
+        : a(n)
+        , b(n)
+        , out(n)
+    {
+        for (size_t i = 0; i < n; ++i) {
+            a[i] = fr::random_element();
+            b[i] = fr::random_element();
+        }
+    }
+};
+
+void mul_loop_bench(State& state) noexcept
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    BatchInputs inputs(n);
+    for (auto _ : state) {
+        for (size_t i = 0; i < n; ++i) {
+            inputs.out[i] = inputs.a[i] * inputs.b[i];
+        }
+        DoNotOptimize(inputs.out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(mul_loop_bench)->RangeMultiplier(16)->Range(1 << 8, 1 << 16);
+
+void mul_batch_bench(State& state) noexcept
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    BatchInputs inputs(n);
+    for (auto _ : state) {
+        fr::mul_batch(inputs.out.data(), inputs.a.data(), inputs.b.data(), n);
+        DoNotOptimize(inputs.out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(mul_batch_bench)->RangeMultiplier(16)->Range(1 << 8, 1 << 16);
+
+void fma_loop_bench(State& state) noexcept
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    BatchInputs inputs(n);
+    const fr scalar = accx;
+    for (auto _ : state) {
+        for (size_t i = 0; i < n; ++i) {
+            inputs.out[i] = inputs.a[i] * scalar + inputs.b[i];
+        }
+        DoNotOptimize(inputs.out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(fma_loop_bench)->RangeMultiplier(16)->Range(1 << 8, 1 << 16);
+
+void fma_batch_bench(State& state) noexcept
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    BatchInputs inputs(n);
+    const fr scalar = accx;
+    for (auto _ : state) {
+        fr::fma_batch(inputs.out.data(), inputs.a.data(), scalar, inputs.b.data(), n);
+        DoNotOptimize(inputs.out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(fma_batch_bench)->RangeMultiplier(16)->Range(1 << 8, 1 << 16);
+
+void scale_by_powers_loop_bench(State& state) noexcept
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    BatchInputs inputs(n);
+    for (auto _ : state) {
+        fr power = accx;
+        for (size_t i = 0; i < n; ++i) {
+            inputs.out[i] = inputs.a[i] * power;
+            power *= accy;
+        }
+        DoNotOptimize(inputs.out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(scale_by_powers_loop_bench)->RangeMultiplier(16)->Range(1 << 8, 1 << 16);
+
+void scale_by_powers_batch_bench(State& state) noexcept
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    BatchInputs inputs(n);
+    for (auto _ : state) {
+        fr::scale_by_powers_batch(inputs.out.data(), inputs.a.data(), accx, accy, n);
+        DoNotOptimize(inputs.out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(scale_by_powers_batch_bench)->RangeMultiplier(16)->Range(1 << 8, 1 << 16);
+
 // NOLINTNEXTLINE macro invokation triggers style guideline errors from googletest code
 BENCHMARK_MAIN();
@@ -374,4 +374,59 @@ TEST(fr, Uint256Conversions)
 
     static_assert(a == c);
     EXPECT_EQ(a, c);
-}
\ No newline at end of file
+}
+
+TEST(fr, BatchArithmetic)
+{
+    // Sizes which exercise the 8-lane kernels, their scalar tail, and inputs too short for either.
+    for (size_t n : { 0UL, 5UL, 8UL, 37UL, 1000UL }) {
+        std::vector<fr> a(n);
+        std::vector<fr> b(n);
+        std::vector<fr> c(n);
+        for (size_t i = 0; i < n; ++i) {
+            a[i] = fr::random_element();
+            b[i] = fr::random_element();
+            c[i] = fr::random_element();
+        }
+        if (n > 2) {
+            a[0] = 0;
+            b[1] = -fr::one();
+            a[2] = fr(fr::modulus - 1);
+        }
+        const fr scalar = fr::random_element();
+        const fr start = fr::random_element();
+        const fr ratio = fr::random_element();
+
+        std::vector<fr> sum(n);
+        std::vector<fr> difference(n);
+        std::vector<fr> product(n);
+        std::vector<fr> scaled(n);
+        std::vector<fr> fma(n);
+        std::vector<fr> powers(n);
+        fr::add_batch(sum.data(), a.data(), b.data(), n);
+        fr::sub_batch(difference.data(), a.data(), b.data(), n);
+        fr::mul_batch(product.data(), a.data(), b.data(), n);
+        fr::scale_batch(scaled.data(), a.data(), scalar, n);
+        fr::fma_batch(fma.data(), a.data(), scalar, c.data(), n);
+        fr::scale_by_powers_batch(powers.data(), a.data(), start, ratio, n);
+
+        fr power = start;
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(sum[i], a[i] + b[i]);
+            EXPECT_EQ(difference[i], a[i] - b[i]);
+            EXPECT_EQ(product[i], a[i] * b[i]);
+            EXPECT_EQ(scaled[i], a[i] * scalar);
+            EXPECT_EQ(fma[i], a[i] * scalar + c[i]);
+            EXPECT_EQ(powers[i], a[i] * power);
+            power *= ratio;
+        }
+
+        // In place, as the polynomial arithmetic uses them.
+        std::vector<fr> in_place = a;
+        fr::fma_batch(in_place.data(), b.data(), scalar, in_place.data(), n);
+        fr::mul_batch(in_place.data(), in_place.data(), c.data(), n);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(in_place[i], (a[i] + b[i] * scalar) * c[i]);
+        }
+    }
+}
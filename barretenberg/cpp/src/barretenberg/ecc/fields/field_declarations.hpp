@@ -20,6 +20,13 @@
 #define BBERG_NO_ASM 1
 #endif
 
+// The AVX-512 IFMA kernels of the batch operations, chosen at runtime (see field_impl_batch.hpp).
+#if (BBERG_NO_ASM == 0) && defined(__x86_64__)
+#define BBERG_BATCH_IFMA 1
+#else
+#define BBERG_BATCH_IFMA 0
+#endif
+
 namespace barretenberg {
 template <class Params_> struct alignas(32) field {
   public:
@@ -238,6 +245,19 @@ template <class Params_> struct alignas(32) field {
     constexpr field invert() const noexcept;
     static void batch_invert(std::span<field> coeffs) noexcept;
     static void batch_invert(field* coeffs, size_t n) noexcept;
+
+    // Elementwise operations over arrays of n elements, vectorised where the CPU allows. out may alias the inputs.
+    static void add_batch(field* out, const field* a, const field* b, size_t n) noexcept;
+    static void sub_batch(field* out, const field* a, const field* b, size_t n) noexcept;
+    // out[i] = a[i] * b[i]
+    static void mul_batch(field* out, const field* a, const field* b, size_t n) noexcept;
+    // out[i] = a[i] * b
+    static void scale_batch(field* out, const field* a, const field& b, size_t n) noexcept;
+    // out[i] = a[i] * b + c[i]
+    static void fma_batch(field* out, const field* a, const field& b, const field* c, size_t n) noexcept;
+    // out[i] = a[i] * start * ratio^i
+    static void scale_by_powers_batch(
+        field* out, const field* a, const field& start, const field& ratio, size_t n) noexcept;
     /**
      * @brief Compute square root of the field element.
      *
@@ -440,6 +460,14 @@ template <class Params_> struct alignas(32) field {
     void msgpack_schema(auto& packer) const { packer.pack_alias(Params::schema_name, "bin32"); }
 
   private:
+    static constexpr bool batch_ifma_supported() noexcept;
+#if BBERG_BATCH_IFMA
+    static size_t ifma_mul_add_batch(
+        field* out, const field* a, const field* b, bool broadcast_b, const field* c, size_t n) noexcept;
+    static size_t ifma_scale_by_powers_batch(
+        field* out, const field* a, const field& start, const field& ratio, size_t n) noexcept;
+#endif
+
     static constexpr uint256_t twice_modulus = modulus + modulus;
     static constexpr uint256_t not_modulus = -modulus;
     static constexpr uint256_t twice_not_modulus = -twice_modulus;
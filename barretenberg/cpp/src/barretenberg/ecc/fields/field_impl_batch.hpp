@@ -0,0 +1,360 @@
+#pragma once
+#include "./field_impl.hpp"
+
+#if BBERG_BATCH_IFMA
+#include <immintrin.h>
+#endif
+
+/**
+ * Elementwise arithmetic over arrays of field elements.
+ *
+ * Our scalar multiplication (field_impl_x64.hpp) is a MULX/ADX chain over 64-bit limbs, which leaves the vector units
+ * idle. Where the CPU has AVX-512 IFMA, mul_batch, scale_batch, fma_batch and scale_by_powers_batch instead multiply
+ * eight elements at a time, in a radix-2^52 layout: each element is five 52-bit limbs, and limb k of eight elements
+ * fills one 512-bit register, so that vpmadd52{lo,hi}uq compute the limb products of all eight at once. Other CPUs,
+ * fields of 254 bits or more, and the last n mod 8 elements take the scalar path.
+ */
+namespace barretenberg {
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-c-arrays, readability-magic-numbers)
+#if BBERG_BATCH_IFMA
+// GCC 12 reports the _mm512_undefined_epi32() placeholders inside its own AVX-512 intrinsics as uninitialised.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+namespace field_batch_ifma {
+
+#define BBERG_IFMA_TARGET __attribute__((target("avx512f,avx512ifma")))
+
+inline bool cpu_supported()
+{
+    static const bool supported = __builtin_cpu_supports("avx512ifma") != 0;
+    return supported;
+}
+
+constexpr uint64_t LIMB_MASK = (1ULL << 52) - 1;
+
+/**
+ * @brief Eight field elements, as five 52-bit limbs each.
+ */
+struct Limbs {
+    __m512i limbs[5];
+};
+
+/**
+ * @brief Eight copies of one element.
+ */
+template <int shift> BBERG_IFMA_TARGET inline Limbs broadcast(const uint64_t w[4])
+{
+    const uint64_t limbs[5] = {
+        (w[0] << shift) & LIMB_MASK,
+        ((w[0] >> (52 - shift)) | (w[1] << (12 + shift))) & LIMB_MASK,
+        ((w[1] >> (40 - shift)) | (w[2] << (24 + shift))) & LIMB_MASK,
+        ((w[2] >> (28 - shift)) | (w[3] << (36 + shift))) & LIMB_MASK,
+        w[3] >> (16 - shift),
+    };
+    Limbs out;
+    for (size_t k = 0; k < 5; ++k) {
+        out.limbs[k] = _mm512_set1_epi64(static_cast<int64_t>(limbs[k]));
+    }
+    return out;
+}
+
+/**
+ * @brief Load eight consecutive elements, as the limbs of value.2^shift.
+ *
+ * @details The montgomery form of x is x.2^256, while our radix-2^52 montgomery_mul divides by 2^260. Loading one
+ * operand of each product shifted by 4 bits makes the two agree, so values stay in the standard montgomery form.
+ */
+template <int shift> BBERG_IFMA_TARGET inline Limbs load(const uint64_t* data)
+{
+    const __m512i v0 = _mm512_loadu_si512(data);
+    const __m512i v1 = _mm512_loadu_si512(data + 8);
+    const __m512i v2 = _mm512_loadu_si512(data + 16);
+    const __m512i v3 = _mm512_loadu_si512(data + 24);
+    // Transpose, so that words[k] holds word k of the eight elements.
+    const __m512i low_words = _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13);
+    const __m512i high_words = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+    const __m512i p = _mm512_permutex2var_epi64(v0, low_words, v1);
+    const __m512i q = _mm512_permutex2var_epi64(v2, low_words, v3);
+    const __m512i r = _mm512_permutex2var_epi64(v0, high_words, v1);
+    const __m512i s = _mm512_permutex2var_epi64(v2, high_words, v3);
+    const __m512i words[4] = {
+        _mm512_shuffle_i64x2(p, q, 0x44),
+        _mm512_shuffle_i64x2(p, q, 0xEE),
+        _mm512_shuffle_i64x2(r, s, 0x44),
+        _mm512_shuffle_i64x2(r, s, 0xEE),
+    };
+    const __m512i mask = _mm512_set1_epi64(static_cast<int64_t>(LIMB_MASK));
+    Limbs out;
+    out.limbs[0] = _mm512_and_si512(_mm512_slli_epi64(words[0], shift), mask);
+    out.limbs[1] = _mm512_and_si512(
+        _mm512_or_si512(_mm512_srli_epi64(words[0], 52 - shift), _mm512_slli_epi64(words[1], 12 + shift)), mask);
+    out.limbs[2] = _mm512_and_si512(
+        _mm512_or_si512(_mm512_srli_epi64(words[1], 40 - shift), _mm512_slli_epi64(words[2], 24 + shift)), mask);
+    out.limbs[3] = _mm512_and_si512(
+        _mm512_or_si512(_mm512_srli_epi64(words[2], 28 - shift), _mm512_slli_epi64(words[3], 36 + shift)), mask);
+    out.limbs[4] = _mm512_srli_epi64(words[3], 16 - shift);
+    return out;
+}
+
+/**
+ * @brief Store eight consecutive elements from normalised limbs.
+ */
+BBERG_IFMA_TARGET inline void store(uint64_t* data, const Limbs& in)
+{
+    const __m512i d0 = _mm512_or_si512(in.limbs[0], _mm512_slli_epi64(in.limbs[1], 52));
+    const __m512i d1 = _mm512_or_si512(_mm512_srli_epi64(in.limbs[1], 12), _mm512_slli_epi64(in.limbs[2], 40));
+    const __m512i d2 = _mm512_or_si512(_mm512_srli_epi64(in.limbs[2], 24), _mm512_slli_epi64(in.limbs[3], 28));
+    const __m512i d3 = _mm512_or_si512(_mm512_srli_epi64(in.limbs[3], 36), _mm512_slli_epi64(in.limbs[4], 16));
+    // The inverse of the transposition in load.
+    const __m512i low_words = _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13);
+    const __m512i high_words = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+    const __m512i p = _mm512_shuffle_i64x2(d0, d1, 0x44);
+    const __m512i q = _mm512_shuffle_i64x2(d0, d1, 0xEE);
+    const __m512i r = _mm512_shuffle_i64x2(d2, d3, 0x44);
+    const __m512i s = _mm512_shuffle_i64x2(d2, d3, 0xEE);
+    _mm512_storeu_si512(data, _mm512_permutex2var_epi64(p, low_words, r));
+    _mm512_storeu_si512(data + 8, _mm512_permutex2var_epi64(p, high_words, r));
+    _mm512_storeu_si512(data + 16, _mm512_permutex2var_epi64(q, low_words, s));
+    _mm512_storeu_si512(data + 24, _mm512_permutex2var_epi64(q, high_words, s));
+}
+
+/**
+ * @brief Carry limbs 0-3 into their successors, leaving them below 2^52.
+ */
+BBERG_IFMA_TARGET inline void normalise(Limbs& a)
+{
+    const __m512i mask = _mm512_set1_epi64(static_cast<int64_t>(LIMB_MASK));
+    for (size_t k = 0; k < 4; ++k) {
+        a.limbs[k + 1] = _mm512_add_epi64(a.limbs[k + 1], _mm512_srli_epi64(a.limbs[k], 52));
+        a.limbs[k] = _mm512_and_si512(a.limbs[k], mask);
+    }
+}
+
+/**
+ * @brief a - m where a >= m, for normalised a.
+ */
+BBERG_IFMA_TARGET inline void conditional_subtract(Limbs& a, const Limbs& m)
+{
+    const __m512i mask = _mm512_set1_epi64(static_cast<int64_t>(LIMB_MASK));
+    Limbs difference;
+    __m512i borrow = _mm512_setzero_si512();
+    for (size_t k = 0; k < 5; ++k) {
+        const __m512i limb = _mm512_sub_epi64(_mm512_sub_epi64(a.limbs[k], m.limbs[k]), borrow);
+        borrow = _mm512_srli_epi64(limb, 63);
+        difference.limbs[k] = _mm512_and_si512(limb, mask);
+    }
+    const __mmask8 no_borrow = _mm512_cmpeq_epi64_mask(borrow, _mm512_setzero_si512());
+    for (size_t k = 0; k < 5; ++k) {
+        a.limbs[k] = _mm512_mask_blend_epi64(no_borrow, a.limbs[k], difference.limbs[k]);
+    }
+}
+
+/**
+ * @brief Shift normalised limbs of a value below 2^256 left by 4 bits, as load<4> would.
+ */
+BBERG_IFMA_TARGET inline void shift_left_4(Limbs& a)
+{
+    const __m512i mask = _mm512_set1_epi64(static_cast<int64_t>(LIMB_MASK));
+    for (size_t k = 4; k > 0; --k) {
+        a.limbs[k] = _mm512_or_si512(_mm512_and_si512(_mm512_slli_epi64(a.limbs[k], 4), mask),
+                                     _mm512_srli_epi64(a.limbs[k - 1], 48));
+    }
+    a.limbs[0] = _mm512_and_si512(_mm512_slli_epi64(a.limbs[0], 4), mask);
+}
+
+/**
+ * @brief x.y / 2^260 mod p, in normalised limbs below 2p when x.y < p.2^260.
+ *
+ * @details Operand scanning: for each limb x_i, add x_i.y and then the multiple m.p of the modulus which clears the
+ * lowest limb, and drop that limb. The accumulators stay below 2^58, so carries are only propagated at the end.
+ */
+BBERG_IFMA_TARGET inline Limbs montgomery_mul(const Limbs& x, const Limbs& y, const Limbs& p, const __m512i p_inv)
+{
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i mask = _mm512_set1_epi64(static_cast<int64_t>(LIMB_MASK));
+    __m512i t[6] = { zero, zero, zero, zero, zero, zero };
+    for (size_t i = 0; i < 5; ++i) {
+        for (size_t k = 0; k < 5; ++k) {
+            t[k] = _mm512_madd52lo_epu64(t[k], x.limbs[i], y.limbs[k]);
+            t[k + 1] = _mm512_madd52hi_epu64(t[k + 1], x.limbs[i], y.limbs[k]);
+        }
+        const __m512i m = _mm512_and_si512(_mm512_madd52lo_epu64(zero, t[0], p_inv), mask);
+        for (size_t k = 0; k < 5; ++k) {
+            t[k] = _mm512_madd52lo_epu64(t[k], m, p.limbs[k]);
+            t[k + 1] = _mm512_madd52hi_epu64(t[k + 1], m, p.limbs[k]);
+        }
+        t[1] = _mm512_add_epi64(t[1], _mm512_srli_epi64(t[0], 52));
+        for (size_t k = 0; k < 5; ++k) {
+            t[k] = t[k + 1];
+        }
+        t[5] = zero;
+    }
+    Limbs out{ { t[0], t[1], t[2], t[3], t[4] } };
+    normalise(out);
+    return out;
+}
+
+} // namespace field_batch_ifma
+
+template <class T>
+BBERG_IFMA_TARGET size_t field<T>::ifma_mul_add_batch(
+    field* out, const field* a, const field* b, const bool broadcast_b, const field* c, const size_t n) noexcept
+{
+    const size_t num_blocks = n / 8;
+    if (num_blocks == 0) {
+        return 0;
+    }
+    using namespace field_batch_ifma;
+    const Limbs p = broadcast<0>(&modulus.data[0]);
+    const Limbs twice_p = broadcast<0>(&twice_modulus.data[0]);
+    const __m512i p_inv = _mm512_set1_epi64(static_cast<int64_t>(T::r_inv & LIMB_MASK));
+    const Limbs b_copies = broadcast<0>(&b[0].data[0]);
+
+    for (size_t block = 0; block < num_blocks; ++block) {
+        const size_t i = block * 8;
+        const Limbs x = load<4>(&a[i].data[0]);
+        const Limbs y = broadcast_b ? b_copies : load<0>(&b[i].data[0]);
+        Limbs result = field_batch_ifma::montgomery_mul(x, y, p, p_inv);
+        if (c != nullptr) {
+            const Limbs addend = load<0>(&c[i].data[0]);
+            for (size_t k = 0; k < 5; ++k) {
+                result.limbs[k] = _mm512_add_epi64(result.limbs[k], addend.limbs[k]);
+            }
+            normalise(result);
+            conditional_subtract(result, twice_p);
+        }
+        store(&out[i].data[0], result);
+    }
+    return num_blocks * 8;
+}
+
+template <class T>
+BBERG_IFMA_TARGET size_t field<T>::ifma_scale_by_powers_batch(
+    field* out, const field* a, const field& start, const field& ratio, const size_t n) noexcept
+{
+    const size_t num_blocks = n / 8;
+    if (num_blocks == 0) {
+        return 0;
+    }
+    using namespace field_batch_ifma;
+    const Limbs p = broadcast<0>(&modulus.data[0]);
+    const __m512i p_inv = _mm512_set1_epi64(static_cast<int64_t>(T::r_inv & LIMB_MASK));
+
+    // Lane j holds start.ratio^{i + j}, shifted for use as the first operand; each block steps it by ratio^8.
+    field initial_powers[8];
+    initial_powers[0] = start;
+    for (size_t j = 1; j < 8; ++j) {
+        initial_powers[j] = initial_powers[j - 1] * ratio;
+    }
+    Limbs powers = load<4>(&initial_powers[0].data[0]);
+    const field ratio_8 = ratio.pow(8);
+    const Limbs step = broadcast<0>(&ratio_8.data[0]);
+
+    for (size_t block = 0; block < num_blocks; ++block) {
+        const size_t i = block * 8;
+        store(&out[i].data[0], field_batch_ifma::montgomery_mul(powers, load<0>(&a[i].data[0]), p, p_inv));
+        powers = field_batch_ifma::montgomery_mul(powers, step, p, p_inv);
+        shift_left_4(powers);
+    }
+    return num_blocks * 8;
+}
+
+#undef BBERG_IFMA_TARGET
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+template <class T> constexpr bool field<T>::batch_ifma_supported() noexcept
+{
+    // montgomery_mul needs 16.(2p)^2 < p.2^260, i.e. p < 2^254. As for operator*, fields of at most 64 bits have their
+    // own representation.
+    return BBERG_BATCH_IFMA && T::modulus_3 < 0x4000000000000000ULL &&
+           !(T::modulus_1 == 0 && T::modulus_2 == 0 && T::modulus_3 == 0);
+}
+
+template <class T> void field<T>::add_batch(field* out, const field* a, const field* b, const size_t n) noexcept
+{
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = a[i] + b[i];
+    }
+}
+
+template <class T> void field<T>::sub_batch(field* out, const field* a, const field* b, const size_t n) noexcept
+{
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = a[i] - b[i];
+    }
+}
+
+template <class T> void field<T>::mul_batch(field* out, const field* a, const field* b, const size_t n) noexcept
+{
+    size_t i = 0;
+#if BBERG_BATCH_IFMA
+    if constexpr (batch_ifma_supported()) {
+        if (field_batch_ifma::cpu_supported()) {
+            i = ifma_mul_add_batch(out, a, b, false, nullptr, n);
+        }
+    }
+#endif
+    for (; i < n; ++i) {
+        out[i] = a[i] * b[i];
+    }
+}
+
+template <class T> void field<T>::scale_batch(field* out, const field* a, const field& b, const size_t n) noexcept
+{
+    size_t i = 0;
+#if BBERG_BATCH_IFMA
+    if constexpr (batch_ifma_supported()) {
+        if (field_batch_ifma::cpu_supported()) {
+            i = ifma_mul_add_batch(out, a, &b, true, nullptr, n);
+        }
+    }
+#endif
+    for (; i < n; ++i) {
+        out[i] = a[i] * b;
+    }
+}
+
+template <class T>
+void field<T>::fma_batch(field* out, const field* a, const field& b, const field* c, const size_t n) noexcept
+{
+    size_t i = 0;
+#if BBERG_BATCH_IFMA
+    if constexpr (batch_ifma_supported()) {
+        if (field_batch_ifma::cpu_supported()) {
+            i = ifma_mul_add_batch(out, a, &b, true, c, n);
+        }
+    }
+#endif
+    for (; i < n; ++i) {
+        out[i] = a[i] * b + c[i];
+    }
+}
+
+template <class T>
+void field<T>::scale_by_powers_batch(
+    field* out, const field* a, const field& start, const field& ratio, const size_t n) noexcept
+{
+    size_t i = 0;
+#if BBERG_BATCH_IFMA
+    if constexpr (batch_ifma_supported()) {
+        if (field_batch_ifma::cpu_supported()) {
+            i = ifma_scale_by_powers_batch(out, a, start, ratio, n);
+        }
+    }
+#endif
+    field power = i == 0 ? start : start * ratio.pow(static_cast<uint64_t>(i));
+    for (; i < n; ++i) {
+        out[i] = a[i] * power;
+        power *= ratio;
+    }
+}
+// NOLINTEND(cppcoreguidelines-avoid-c-arrays, readability-magic-numbers)
+
+} // namespace barretenberg
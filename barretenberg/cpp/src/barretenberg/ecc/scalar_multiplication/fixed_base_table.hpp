@@ -0,0 +1,150 @@
+#pragma once
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace barretenberg::scalar_multiplication {
+
+/**
+ * @brief Precomputed multiples of a fixed point P, to compute k.P with table lookups rather than a scalar
+ * multiplication.
+ *
+ * @details The scalar is split into w-bit windows, k = Σ k_i.2^{w.i}, and the table holds j.2^{w.i}.P for each window i
+ * and each j in [1, 2^w). Then k.P = Σ table[i][k_i]: one mixed addition per window, and no doublings. For a 254-bit
+ * scalar field the table holds ⌈254 / w⌉.(2^w - 1) points, so the window size trades memory for speed:
+ *
+ *      w = 4:    960 points,  60 KB, 64 additions
+ *      w = 6:   2709 points, 170 KB, 43 additions
+ *      w = 8:   8160 points, 510 KB, 32 additions
+ */
+template <typename Curve> class FixedBaseTable {
+  public:
+    using ScalarField = typename Curve::ScalarField;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+
+    static constexpr size_t DEFAULT_WINDOW_BITS = 6;
+    static constexpr size_t MAX_WINDOW_BITS = 16;
+
+    explicit FixedBaseTable(const AffineElement& base, size_t window_bits = DEFAULT_WINDOW_BITS)
+        : base_(base)
+        , window_bits_(window_bits)
+        , num_windows_((static_cast<size_t>(ScalarField::modulus.get_msb()) + window_bits) / window_bits)
+    {
+        ASSERT(window_bits > 0 && window_bits <= MAX_WINDOW_BITS);
+        if (base.is_point_at_infinity()) {
+            return;
+        }
+        const size_t window_size = points_per_window();
+        std::vector<Element> multiples(num_windows_ * window_size);
+        Element window_base(base);
+        for (size_t i = 0; i < num_windows_; ++i) {
+            Element* window = &multiples[i * window_size];
+            window[0] = window_base;
+            for (size_t j = 1; j < window_size; ++j) {
+                window[j] = window[j - 1] + window_base;
+            }
+            // 2^w.window_base, the base of the next window.
+            window_base = window[window_size - 1] + window_base;
+        }
+        Element::batch_normalize(&multiples[0], multiples.size());
+        table_.reserve(multiples.size());
+        for (const auto& multiple : multiples) {
+            table_.emplace_back(multiple.x, multiple.y);
+        }
+    }
+
+    const AffineElement& base() const { return base_; }
+    size_t window_bits() const { return window_bits_; }
+    size_t memory_usage() const { return table_.size() * sizeof(AffineElement); }
+
+    /**
+     * @brief Add scalar.P to the accumulator.
+     */
+    void accumulate(Element& accumulator, const ScalarField& scalar) const
+    {
+        if (table_.empty()) {
+            return;
+        }
+        const auto k = static_cast<uint256_t>(scalar);
+        const size_t window_size = points_per_window();
+        for (size_t i = 0; i < num_windows_; ++i) {
+            const size_t lo = i * window_bits_;
+            const auto digit = static_cast<size_t>(k.slice(lo, std::min(lo + window_bits_, size_t(256))).data[0]);
+            if (digit != 0) {
+                accumulator += table_[i * window_size + digit - 1];
+            }
+        }
+    }
+
+    Element mul(const ScalarField& scalar) const
+    {
+        Element result = Element::infinity();
+        accumulate(result, scalar);
+        return result;
+    }
+
+  private:
+    size_t points_per_window() const { return (static_cast<size_t>(1) << window_bits_) - 1; }
+
+    AffineElement base_;
+    size_t window_bits_;
+    size_t num_windows_;
+    std::vector<AffineElement> table_;
+};
+
+/**
+ * @brief Fixed-base tables for a set of points, e.g. the commitments of a verification key, found by point.
+ */
+template <typename Curve> class FixedBaseTables {
+  public:
+    using ScalarField = typename Curve::ScalarField;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+
+    explicit FixedBaseTables(std::span<const AffineElement> bases,
+                             size_t window_bits = FixedBaseTable<Curve>::DEFAULT_WINDOW_BITS)
+    {
+        std::vector<std::optional<FixedBaseTable<Curve>>> tables(bases.size());
+        parallel_for(bases.size(), [&](size_t i) { tables[i].emplace(bases[i], window_bits); });
+        tables_.reserve(bases.size());
+        for (auto& table : tables) {
+            tables_.emplace_back(std::move(*table));
+        }
+    }
+
+    /**
+     * @brief The table of the point, or nullptr if there is none.
+     */
+    const FixedBaseTable<Curve>* find(const AffineElement& point) const
+    {
+        // There are a few dozen tables at most, so this costs far less than an addition.
+        for (const auto& table : tables_) {
+            if (table.base() == point) {
+                return &table;
+            }
+        }
+        return nullptr;
+    }
+
+    size_t size() const { return tables_.size(); }
+
+    size_t memory_usage() const
+    {
+        size_t result = 0;
+        for (const auto& table : tables_) {
+            result += table.memory_usage();
+        }
+        return result;
+    }
+
+  private:
+    std::vector<FixedBaseTable<Curve>> tables_;
+};
+
+} // namespace barretenberg::scalar_multiplication
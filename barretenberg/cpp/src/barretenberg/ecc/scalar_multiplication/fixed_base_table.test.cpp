@@ -0,0 +1,53 @@
+#include "fixed_base_table.hpp"
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include <gtest/gtest.h>
+
+using namespace barretenberg;
+using namespace barretenberg::scalar_multiplication;
+
+TEST(fixed_base_table, matches_scalar_multiplication)
+{
+    const g1::affine_element base(g1::element::random_element());
+    for (size_t window_bits : { 1UL, 4UL, 6UL, 7UL }) {
+        const FixedBaseTable<curve::BN254> table(base, window_bits);
+        EXPECT_EQ(table.memory_usage(),
+                  ((254 + window_bits - 1) / window_bits) * ((1UL << window_bits) - 1) * sizeof(g1::affine_element));
+        for (size_t i = 0; i < 8; ++i) {
+            const fr scalar = fr::random_element();
+            EXPECT_EQ(g1::affine_element(table.mul(scalar)), g1::affine_element(base * scalar));
+        }
+        EXPECT_TRUE(table.mul(fr::zero()).is_point_at_infinity());
+        EXPECT_EQ(g1::affine_element(table.mul(fr::one())), base);
+        EXPECT_EQ(g1::affine_element(table.mul(fr::neg_one())), -base);
+    }
+}
+
+TEST(fixed_base_table, point_at_infinity)
+{
+    g1::affine_element base;
+    base.self_set_infinity();
+    const FixedBaseTable<curve::BN254> table(base);
+    EXPECT_EQ(table.memory_usage(), 0UL);
+    EXPECT_TRUE(table.mul(fr::random_element()).is_point_at_infinity());
+}
+
+TEST(fixed_base_table, find)
+{
+    std::vector<g1::affine_element> bases;
+    for (size_t i = 0; i < 3; ++i) {
+        bases.emplace_back(g1::element::random_element());
+    }
+    const FixedBaseTables<curve::BN254> tables(bases, 4);
+    EXPECT_EQ(tables.size(), 3UL);
+    for (const auto& base : bases) {
+        const auto* table = tables.find(base);
+        ASSERT_NE(table, nullptr);
+        EXPECT_EQ(table->base(), base);
+
+        const fr scalar = fr::random_element();
+        g1::element accumulator = g1::element(bases[0]);
+        table->accumulate(accumulator, scalar);
+        EXPECT_EQ(g1::affine_element(accumulator), g1::affine_element(base * scalar + bases[0]));
+    }
+    EXPECT_EQ(tables.find(g1::affine_element(g1::element::random_element())), nullptr);
+}
@@ -1,5 +1,6 @@
 #pragma once
 #include "barretenberg/common/mem.hpp"
+#include "barretenberg/common/memory_policy.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/bn254/g1.hpp"
 #include <memory>
@@ -22,7 +23,10 @@ inline size_t point_table_buf_size(size_t num_points)
 
 template <typename T> inline std::shared_ptr<T[]> point_table_alloc(size_t num_points)
 {
-    return std::static_pointer_cast<T[]>(get_mem_slab(point_table_buf_size(num_points)));
+    auto table = std::static_pointer_cast<T[]>(get_mem_slab(point_table_buf_size(num_points)));
+    // Place the pages of the table before the points are read into it, so they follow the memory policy.
+    zero_new_memory(static_cast<void*>(table.get()), point_table_buf_size(num_points));
+    return table;
 }
 
 } // namespace barretenberg::scalar_multiplication
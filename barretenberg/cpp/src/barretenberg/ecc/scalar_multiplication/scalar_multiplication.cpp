@@ -7,10 +7,12 @@
 #include "./process_buckets.hpp"
 #include "./runtime_states.hpp"
 #include "./scalar_multiplication.hpp"
+#include "./small_msm.hpp"
 
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/common/trace.hpp"
 #include "barretenberg/ecc/groups/wnaf.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 
@@ -861,9 +863,21 @@ typename Curve::Element pippenger_internal(typename Curve::AffineElement* points
                                            pippenger_runtime_state<Curve>& state,
                                            bool handle_edge_cases)
 {
+    BB_TRACE_SCOPE_COUNTS("pippenger",
+                          num_initial_points,
+                          num_initial_points * (2 * sizeof(typename Curve::AffineElement) +
+                                                sizeof(typename Curve::ScalarField)));
     // multiplication_runtime_state state;
-    compute_wnaf_states<Curve>(state.point_schedule, state.skew_table, state.round_counts, scalars, num_initial_points);
-    organize_buckets(state.point_schedule, num_initial_points * 2);
+    {
+        BB_TRACE_SCOPE("pippenger::compute_wnaf_states");
+        compute_wnaf_states<Curve>(
+            state.point_schedule, state.skew_table, state.round_counts, scalars, num_initial_points);
+    }
+    {
+        BB_TRACE_SCOPE("pippenger::organize_buckets");
+        organize_buckets(state.point_schedule, num_initial_points * 2);
+    }
+    BB_TRACE_SCOPE("pippenger::evaluate_pippenger_rounds");
     typename Curve::Element result =
         evaluate_pippenger_rounds<Curve>(state, points, num_initial_points * 2, handle_edge_cases);
     return result;
@@ -880,10 +894,9 @@ typename Curve::Element pippenger(typename Curve::ScalarField* scalars,
     using Element = typename Curve::Element;
 
     // our windowed non-adjacent form algorthm requires that each thread can work on at least 8 points.
-    // If we fall below this theshold, fall back to the traditional scalar multiplication algorithm.
-    // For 8 threads, this neatly coincides with the threshold where Strauss scalar multiplication outperforms
-    // Pippenger
-    const size_t threshold = get_num_cpus_pow2() * 8;
+    // If we fall below this theshold, or below the size at which Straus' algorithm outperforms pippenger, fall back to
+    // Straus' algorithm.
+    const size_t threshold = std::max(get_num_cpus_pow2() * 8, SMALL_MSM_THRESHOLD);
 
     if (num_initial_points == 0) {
         Element out = Group::one;
@@ -892,16 +905,8 @@ typename Curve::Element pippenger(typename Curve::ScalarField* scalars,
     }
 
     if (num_initial_points <= threshold) {
-        std::vector<Element> exponentiation_results(num_initial_points);
-        // might as well multithread this...
-        // Possible optimization: use group::batch_mul_with_endomorphism here.
-        parallel_for(num_initial_points,
-                     [&](size_t i) { exponentiation_results[i] = Element(points[i * 2]) * scalars[i]; });
-
-        for (size_t i = num_initial_points - 1; i > 0; --i) {
-            exponentiation_results[i - 1] += exponentiation_results[i];
-        }
-        return exponentiation_results[0];
+        // The points are a pippenger point table, in which the point itself is every other element.
+        return small_msm<Curve>(scalars, points, num_initial_points, /*point_stride=*/2);
     }
 
     const auto slice_bits = static_cast<size_t>(numeric::get_msb(static_cast<uint64_t>(num_initial_points)));
@@ -950,6 +955,10 @@ typename Curve::Element pippenger_without_endomorphism_basis_points(typename Cur
                                                                     const size_t num_initial_points,
                                                                     pippenger_runtime_state<Curve>& state)
 {
+    // Small MSMs don't need the endomorphism point table.
+    if (num_initial_points <= std::max(get_num_cpus_pow2() * 8, SMALL_MSM_THRESHOLD)) {
+        return small_msm<Curve>(scalars, points, num_initial_points);
+    }
     std::vector<typename Curve::AffineElement> G_mod(num_initial_points * 2);
     barretenberg::scalar_multiplication::generate_pippenger_point_table<Curve>(points, &G_mod[0], num_initial_points);
     return pippenger(scalars, &G_mod[0], num_initial_points, state, false);
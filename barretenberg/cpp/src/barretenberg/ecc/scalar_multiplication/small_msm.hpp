@@ -0,0 +1,144 @@
+#pragma once
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace barretenberg::scalar_multiplication {
+
+/**
+ * Below this many points, pippenger and pippenger_without_endomorphism_basis_points compute the multi-scalar
+ * multiplication with small_msm. The verifiers' MSMs (the KZG, Shplonk and IPA batches, the plonk verifier's pairing
+ * inputs) all fall below it; there, pippenger's runtime state, point schedule and bucket reduction cost more than the
+ * additions they save.
+ */
+constexpr size_t SMALL_MSM_THRESHOLD = 64;
+constexpr size_t SMALL_MSM_WINDOW_BITS = 5;
+
+namespace small_msm_detail {
+
+/**
+ * @brief Recode a scalar into signed w-bit digits d_i ∈ [-2^{w-1}, 2^{w-1}], with scalar = Σ d_i.2^{w.i}.
+ */
+template <size_t WINDOW_BITS, size_t NUM_WINDOWS>
+std::array<int32_t, NUM_WINDOWS> signed_window_digits(const uint256_t& scalar)
+{
+    constexpr uint64_t mask = (1ULL << WINDOW_BITS) - 1;
+    constexpr auto half = static_cast<int32_t>(1U << (WINDOW_BITS - 1));
+    std::array<int32_t, NUM_WINDOWS> digits;
+    int32_t carry = 0;
+    for (size_t i = 0; i < NUM_WINDOWS; ++i) {
+        const size_t lo = i * WINDOW_BITS;
+        const auto raw = lo < 256 ? static_cast<int32_t>((scalar >> lo).data[0] & mask) : 0;
+        int32_t digit = raw + carry;
+        carry = digit > half ? 1 : 0;
+        digits[i] = digit - (carry << WINDOW_BITS);
+    }
+    return digits;
+}
+
+/**
+ * @brief Straus' algorithm for a chunk of the points: all points share one chain of doublings, and each window adds
+ * one precomputed multiple of each point.
+ */
+template <typename Curve, size_t WINDOW_BITS>
+typename Curve::Element straus(const typename Curve::ScalarField* scalars,
+                               const typename Curve::AffineElement* points,
+                               const size_t num_points,
+                               const size_t point_stride)
+{
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using ScalarField = typename Curve::ScalarField;
+    // One more window than the bits of the modulus need, to absorb the carry of the signed recoding.
+    constexpr size_t NUM_WINDOWS = (static_cast<size_t>(ScalarField::modulus.get_msb()) + 1) / WINDOW_BITS + 1;
+    constexpr size_t TABLE_SIZE = 1UL << (WINDOW_BITS - 1);
+
+    std::vector<std::array<int32_t, NUM_WINDOWS>> digits;
+    std::vector<Element> multiples;
+    digits.reserve(num_points);
+    multiples.reserve(num_points * TABLE_SIZE);
+    for (size_t i = 0; i < num_points; ++i) {
+        const AffineElement& point = points[i * point_stride];
+        if (point.is_point_at_infinity() || scalars[i].is_zero()) {
+            continue;
+        }
+        digits.emplace_back(signed_window_digits<WINDOW_BITS, NUM_WINDOWS>(static_cast<uint256_t>(scalars[i])));
+        // P, 2P, ..., 2^{w-1}P.
+        multiples.emplace_back(point);
+        for (size_t j = 1; j < TABLE_SIZE; ++j) {
+            multiples.emplace_back(multiples.back() + point);
+        }
+    }
+    Element result = Element::infinity();
+    if (digits.empty()) {
+        return result;
+    }
+    Element::batch_normalize(&multiples[0], multiples.size());
+    std::vector<AffineElement> table;
+    table.reserve(multiples.size());
+    for (const auto& multiple : multiples) {
+        table.emplace_back(multiple.x, multiple.y);
+    }
+
+    for (size_t window = NUM_WINDOWS; window-- > 0;) {
+        if (window != NUM_WINDOWS - 1) {
+            for (size_t j = 0; j < WINDOW_BITS; ++j) {
+                result.self_dbl();
+            }
+        }
+        for (size_t i = 0; i < digits.size(); ++i) {
+            const int32_t digit = digits[i][window];
+            if (digit > 0) {
+                result += table[i * TABLE_SIZE + static_cast<size_t>(digit) - 1];
+            } else if (digit < 0) {
+                result -= table[i * TABLE_SIZE + static_cast<size_t>(-digit) - 1];
+            }
+        }
+    }
+    return result;
+}
+
+} // namespace small_msm_detail
+
+/**
+ * @brief Σ scalars[i].points[i * point_stride], with Straus' algorithm over signed WINDOW_BITS-bit windows.
+ *
+ * @details Each point gets a table of 2^{w-1} multiples, so the cost is roughly n.(2^{w-1} + 254 / w) additions plus
+ * 254 doublings shared by all points. Pippenger's buckets need fewer additions per point, but only overtake this
+ * beyond around a hundred points, once they amortise its runtime state and bucket reduction.
+ * Points at infinity and edge cases of the additions are handled, so this is safe to use in verifiers. Pass
+ * point_stride = 2 for points laid out as a pippenger point table.
+ */
+template <typename Curve, size_t WINDOW_BITS = SMALL_MSM_WINDOW_BITS>
+typename Curve::Element small_msm(const typename Curve::ScalarField* scalars,
+                                  const typename Curve::AffineElement* points,
+                                  const size_t num_points,
+                                  const size_t point_stride = 1)
+{
+    static_assert(WINDOW_BITS >= 2 && WINDOW_BITS <= 8);
+    using Element = typename Curve::Element;
+    // Split the points between threads, with enough per thread for the doublings to stay a minor cost.
+    constexpr size_t MIN_POINTS_PER_THREAD = 16;
+    const size_t num_threads = std::clamp(num_points / MIN_POINTS_PER_THREAD, size_t(1), get_num_cpus());
+    if (num_threads == 1) {
+        return small_msm_detail::straus<Curve, WINDOW_BITS>(scalars, points, num_points, point_stride);
+    }
+    std::vector<Element> results(num_threads);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = (thread_idx * num_points) / num_threads;
+        const size_t end = ((thread_idx + 1) * num_points) / num_threads;
+        results[thread_idx] = small_msm_detail::straus<Curve, WINDOW_BITS>(
+            scalars + start, points + start * point_stride, end - start, point_stride);
+    });
+    Element result = results[0];
+    for (size_t i = 1; i < num_threads; ++i) {
+        result += results[i];
+    }
+    return result;
+}
+
+} // namespace barretenberg::scalar_multiplication
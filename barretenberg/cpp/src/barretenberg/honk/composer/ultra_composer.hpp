@@ -22,6 +22,8 @@ template <UltraFlavor Flavor> class UltraComposer_ {
     using PCS = typename Flavor::PCS;
     using CommitmentKey = typename Flavor::CommitmentKey;
     using VerifierCommitmentKey = typename Flavor::VerifierCommitmentKey;
+    // Accumulates the pairing points of many proofs, see UltraVerifier_::accumulate_proof
+    using PairingAccumulator = pcs::kzg::PairingAccumulator<typename Flavor::Curve>;
     using Instance = ProverInstance_<Flavor>;
 
     static constexpr size_t NUM_FOLDING = 2;
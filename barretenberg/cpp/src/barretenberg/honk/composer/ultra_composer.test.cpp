@@ -8,9 +8,11 @@
 #include "barretenberg/proof_system/plookup_tables/types.hpp"
 #include "barretenberg/proof_system/relations/permutation_relation.hpp"
 #include "barretenberg/proof_system/relations/relation_parameters.hpp"
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <gtest/gtest.h>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -116,6 +118,79 @@ TEST_F(UltraHonkComposerTests, PublicInputs)
     prove_and_verify(builder, composer, /*expected_result=*/true);
 }
 
+/**
+ * @brief Check proofs of the same circuit with different witnesses by accumulating their pairing points
+ */
+TEST_F(UltraHonkComposerTests, PairingAccumulation)
+{
+    constexpr size_t num_proofs = 4;
+    std::vector<proof_system::plonk::proof> proofs;
+    std::optional<UltraVerifier> verifier;
+    for (size_t i = 0; i < num_proofs; ++i) {
+        auto builder = proof_system::UltraCircuitBuilder();
+        fr a = fr::random_element();
+        fr b = fr::random_element();
+        uint32_t a_idx = builder.add_public_variable(a);
+        uint32_t b_idx = builder.add_variable(b);
+        uint32_t c_idx = builder.add_variable(a * b);
+        builder.create_mul_gate({ a_idx, b_idx, c_idx, fr(1), fr(-1), fr(0) });
+
+        auto composer = UltraComposer();
+        auto instance = composer.create_instance(builder);
+        auto prover = composer.create_prover(instance);
+        proofs.emplace_back(prover.construct_proof());
+        if (i == 0) {
+            verifier.emplace(composer.create_verifier(instance));
+        }
+    }
+
+    UltraComposer::PairingAccumulator accumulator;
+    for (const auto& proof : proofs) {
+        EXPECT_TRUE(verifier->accumulate_proof(proof, accumulator));
+    }
+    EXPECT_EQ(accumulator.size(), num_proofs);
+    EXPECT_TRUE(accumulator.check(verifier->pcs_verification_key));
+    EXPECT_TRUE(verifier->verify_proofs(proofs));
+
+    // Swap the final KZG quotient commitments of two proofs. Everything up to the pairing check still passes.
+    constexpr size_t commitment_size = 64;
+    std::swap_ranges(proofs[1].proof_data.end() - commitment_size,
+                     proofs[1].proof_data.end(),
+                     proofs[2].proof_data.end() - commitment_size);
+    UltraComposer::PairingAccumulator bad_accumulator;
+    for (const auto& proof : proofs) {
+        EXPECT_TRUE(verifier->accumulate_proof(proof, bad_accumulator));
+    }
+    EXPECT_FALSE(bad_accumulator.check(verifier->pcs_verification_key));
+    EXPECT_FALSE(verifier->verify_proofs(proofs));
+    EXPECT_TRUE(verifier->verify_proof(proofs[0]));
+    EXPECT_FALSE(verifier->verify_proof(proofs[1]));
+}
+
+TEST_F(UltraHonkComposerTests, CommitmentTables)
+{
+    auto builder = proof_system::UltraCircuitBuilder();
+    fr a = fr::random_element();
+    fr b = fr::random_element();
+    uint32_t a_idx = builder.add_public_variable(a);
+    uint32_t b_idx = builder.add_variable(b);
+    uint32_t c_idx = builder.add_variable(a * b);
+    builder.create_mul_gate({ a_idx, b_idx, c_idx, fr(1), fr(-1), fr(0) });
+
+    auto composer = UltraComposer();
+    auto instance = composer.create_instance(builder);
+    auto prover = composer.create_prover(instance);
+    auto proof = prover.construct_proof();
+    auto verifier = composer.create_verifier(instance);
+
+    verifier.key->precompute_commitment_tables(/*window_bits=*/4);
+    EXPECT_EQ(verifier.key->commitment_tables->size(), verifier.key->size());
+    EXPECT_TRUE(verifier.verify_proof(proof));
+
+    proof.proof_data[proof.proof_data.size() / 2] ^= 1;
+    EXPECT_FALSE(verifier.verify_proof(proof));
+}
+
 TEST_F(UltraHonkComposerTests, XorConstraint)
 {
     auto circuit_builder = proof_system::UltraCircuitBuilder();
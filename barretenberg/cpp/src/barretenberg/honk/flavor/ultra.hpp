@@ -269,7 +269,7 @@ class Ultra {
      * that, and split out separate PrecomputedPolynomials/Commitments data for clarity but also for portability of our
      * circuits.
      */
-    using VerificationKey = VerificationKey_<PrecomputedEntities<Commitment, CommitmentHandle>>;
+    using VerificationKey = VerificationKey_<PrecomputedEntities<Commitment, CommitmentHandle>, Curve>;
 
     /**
      * @brief A container for polynomials handles; only stores spans.
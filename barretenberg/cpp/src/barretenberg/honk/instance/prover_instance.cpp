@@ -76,49 +76,23 @@ template <class Flavor> void ProverInstance_<Flavor>::compute_witness(Circuit& c
     size_t s_index = dyadic_circuit_size - tables_size - lookups_size;
     ASSERT(s_index > 0); // We need at least 1 row of zeroes for the permutation argument
 
-    for (auto& table : circuit.lookup_tables) {
+    for (const auto& table : circuit.lookup_tables) {
         const fr table_index(table.table_index);
-        auto& lookup_gates = table.lookup_gates;
+        // The sorted list holds each row of the table once, plus once for each lookup of it, in the order of the table.
+        // So it is a counting sort of the rows looked up, in time linear in the size of the table and the lookups.
+        std::vector<uint32_t> row_counts(table.size, 1);
+        for (const auto row : table.lookup_gates) {
+            ++row_counts[row];
+        }
         for (size_t i = 0; i < table.size; ++i) {
-            if (table.use_twin_keys) {
-                lookup_gates.push_back({
-                    {
-                        table.column_1[i].from_montgomery_form().data[0],
-                        table.column_2[i].from_montgomery_form().data[0],
-                    },
-                    {
-                        table.column_3[i],
-                        0,
-                    },
-                });
-            } else {
-                lookup_gates.push_back({
-                    {
-                        table.column_1[i].from_montgomery_form().data[0],
-                        0,
-                    },
-                    {
-                        table.column_2[i],
-                        table.column_3[i],
-                    },
-                });
+            for (uint32_t j = 0; j < row_counts[i]; ++j) {
+                s_1[s_index] = table.column_1[i];
+                s_2[s_index] = table.column_2[i];
+                s_3[s_index] = table.column_3[i];
+                s_4[s_index] = table_index;
+                ++s_index;
             }
         }
-
-#ifdef NO_TBB
-        std::sort(lookup_gates.begin(), lookup_gates.end());
-#else
-        std::sort(std::execution::par_unseq, lookup_gates.begin(), lookup_gates.end());
-#endif
-
-        for (const auto& entry : lookup_gates) {
-            const auto components = entry.to_sorted_list_components(table.use_twin_keys);
-            s_1[s_index] = components[0];
-            s_2[s_index] = components[1];
-            s_3[s_index] = components[2];
-            s_4[s_index] = table_index;
-            ++s_index;
-        }
     }
 
     // Polynomial memory is zeroed out when constructed with size hint, so we don't have to initialize trailing
@@ -12,6 +12,7 @@
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
+#include "barretenberg/polynomials/active_range_polynomial.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 #include "barretenberg/srs/factories/crs_factory.hpp"
@@ -60,6 +61,10 @@ template <class Curve> class CommitmentKey {
     /**
      * @brief Uses the ProverSRS to create a commitment to p(X)
      *
+     * @details Leading and trailing zero coefficients are skipped, so that the MSM only covers the range of p(X) which
+     * may be non-zero. Finding that range stops at the first non-zero coefficient from either end, so is free for
+     * dense polynomials.
+     *
      * @param polynomial a univariate polynomial p(X) = ∑ᵢ aᵢ⋅Xⁱ
      * @return Commitment computed as C = [p(x)] = ∑ᵢ aᵢ⋅Gᵢ
      */
@@ -67,12 +72,36 @@ template <class Curve> class CommitmentKey {
     {
         const size_t degree = polynomial.size();
         ASSERT(degree <= srs->get_monomial_size());
-        return barretenberg::scalar_multiplication::pippenger_unsafe<Curve>(
-            const_cast<Fr*>(polynomial.data()), srs->get_monomial_points(), degree, pippenger_runtime_state);
+        const auto [start, end] = barretenberg::ActiveRangePolynomial<Fr>::find_active_range(polynomial);
+        return commit_range(polynomial.data() + start, start, end - start);
+    };
+
+    /**
+     * @brief Create a commitment to a polynomial which is zero outside of its active range, with an MSM over that range
+     * only.
+     */
+    Commitment commit(const barretenberg::ActiveRangePolynomial<Fr>& polynomial)
+    {
+        ASSERT(polynomial.size() <= srs->get_monomial_size());
+        return commit_range(
+            polynomial.active_coefficients().data(), polynomial.start_index(), polynomial.active_size());
     };
 
     barretenberg::scalar_multiplication::pippenger_runtime_state<Curve> pippenger_runtime_state;
     std::shared_ptr<barretenberg::srs::factories::ProverCrs<Curve>> srs;
+
+  private:
+    /**
+     * @brief ∑ᵢ aᵢ⋅G_{start + i} for the given num_coefficients coefficients aᵢ.
+     */
+    Commitment commit_range(const Fr* coefficients, size_t start, size_t num_coefficients)
+    {
+        // The SRS holds each point followed by its endomorphism, as laid out by the pippenger point table.
+        return barretenberg::scalar_multiplication::pippenger_unsafe<Curve>(const_cast<Fr*>(coefficients),
+                                                                            srs->get_monomial_points() + 2 * start,
+                                                                            num_coefficients,
+                                                                            pippenger_runtime_state);
+    }
 };
 
 } // namespace proof_system::honk::pcs
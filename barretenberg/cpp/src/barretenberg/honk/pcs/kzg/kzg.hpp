@@ -6,6 +6,7 @@
 #include "barretenberg/honk/transcript/transcript.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 
+#include <array>
 #include <memory>
 #include <utility>
 
@@ -102,4 +103,48 @@ template <typename Curve> class KZG {
         return { P_0, P_1 };
     };
 };
+
+/**
+ * @brief Accumulates the pairing points of many KZG opening claims, so that all of them are checked by one pairing.
+ *
+ * @details Each pair {P₀, P₁} from KZG::compute_pairing_points is scaled by a fresh random challenge r before it is
+ * added, so that with overwhelming probability the accumulated pair {ΣrP₀, ΣrP₁} passes the pairing check only if each
+ * pair does. The first pair needs no scaling.
+ */
+template <typename Curve> class PairingAccumulator {
+    using VK = VerifierCommitmentKey<Curve>;
+    using Fr = typename Curve::ScalarField;
+    using GroupElement = typename Curve::Element;
+
+  public:
+    void accumulate(const std::array<GroupElement, 2>& pairing_points)
+    {
+        if (num_accumulated == 0) {
+            accumulated_points = pairing_points;
+        } else {
+            const Fr challenge = Fr::random_element();
+            accumulated_points[0] += pairing_points[0] * challenge;
+            accumulated_points[1] += pairing_points[1] * challenge;
+        }
+        ++num_accumulated;
+    }
+
+    /**
+     * @brief Perform the pairing check on the accumulated points. An empty accumulator passes.
+     */
+    bool check(const std::shared_ptr<VK>& vk) const
+    {
+        if (num_accumulated == 0) {
+            return true;
+        }
+        return vk->pairing_check(accumulated_points[0], accumulated_points[1]);
+    }
+
+    size_t size() const { return num_accumulated; }
+    const std::array<GroupElement, 2>& get_pairing_points() const { return accumulated_points; }
+
+  private:
+    std::array<GroupElement, 2> accumulated_points;
+    size_t num_accumulated = 0;
+};
 } // namespace proof_system::honk::pcs::kzg
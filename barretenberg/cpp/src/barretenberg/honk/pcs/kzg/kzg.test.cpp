@@ -5,6 +5,7 @@
 
 #include "../commitment_key.test.hpp"
 #include "barretenberg/honk/pcs/claim.hpp"
+#include "barretenberg/polynomials/active_range_polynomial.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 
 #include "barretenberg/ecc/curves/bn254/g1.hpp"
@@ -49,6 +50,46 @@ TYPED_TEST(KZGTest, single)
     EXPECT_EQ(verified, true);
 }
 
+/**
+ * @brief Check that commitments to polynomials with zero ranges, which only run an MSM over their active range, match
+ * the MSM over all of the coefficients, and that they open as the dense polynomial would.
+ */
+TYPED_TEST(KZGTest, active_range_commitment)
+{
+    const size_t n = 64;
+    const size_t start = 20;
+    const size_t end = 40;
+
+    using KZG = KZG<TypeParam>;
+    using Fr = typename TypeParam::ScalarField;
+
+    typename TestFixture::Polynomial witness(n);
+    for (size_t i = start; i < end; ++i) {
+        witness[i] = Fr::random_element();
+    }
+    const barretenberg::ActiveRangePolynomial<Fr> active_witness(witness);
+    EXPECT_EQ(active_witness.start_index(), start);
+    EXPECT_EQ(active_witness.end_index(), end);
+
+    auto* points = this->ck()->srs->get_monomial_points();
+    typename TestFixture::GroupElement expected = barretenberg::scalar_multiplication::pippenger_unsafe<TypeParam>(
+        witness.data().get(), points, n, this->ck()->pippenger_runtime_state);
+    typename TestFixture::Commitment commitment = this->ck()->commit(witness);
+    EXPECT_EQ(commitment, typename TestFixture::Commitment(expected));
+    EXPECT_EQ(this->ck()->commit(active_witness), commitment);
+
+    auto challenge = Fr::random_element();
+    auto evaluation = active_witness.evaluate(challenge);
+    EXPECT_EQ(evaluation, witness.evaluate(challenge));
+    auto opening_pair = OpeningPair<TypeParam>{ challenge, evaluation };
+    auto opening_claim = OpeningClaim<TypeParam>{ opening_pair, commitment };
+
+    auto prover_transcript = ProverTranscript<Fr>::init_empty();
+    KZG::compute_opening_proof(this->ck(), opening_pair, witness, prover_transcript);
+    auto verifier_transcript = VerifierTranscript<Fr>::init_empty(prover_transcript);
+    EXPECT_TRUE(KZG::verify(this->vk(), opening_claim, verifier_transcript));
+}
+
 /**
  * @brief Test full PCS protocol: Gemini, Shplonk, KZG and pairing check
  * @details Demonstrates the full PCS protocol as it is used in the construction and verification
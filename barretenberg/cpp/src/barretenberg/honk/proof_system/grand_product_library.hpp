@@ -107,7 +107,6 @@ void compute_grand_product(const size_t circuit_size,
 
     parallel_for(num_threads, [&](size_t thread_idx) {
         const size_t start = thread_idx * block_size;
-        const size_t end = (thread_idx + 1) * block_size;
         if (thread_idx > 0) {
             FF numerator_scaling = 1;
             FF denominator_scaling = 1;
@@ -116,10 +115,8 @@ void compute_grand_product(const size_t circuit_size,
                 numerator_scaling *= partial_numerators[j];
                 denominator_scaling *= partial_denominators[j];
             }
-            for (size_t i = start; i < end; ++i) {
-                numerator[i] *= numerator_scaling;
-                denominator[i] *= denominator_scaling;
-            }
+            FF::scale_batch(&numerator[start], &numerator[start], numerator_scaling, block_size);
+            FF::scale_batch(&denominator[start], &denominator[start], denominator_scaling, block_size);
         }
 
         // Final step: invert denominator
@@ -132,9 +129,7 @@ void compute_grand_product(const size_t circuit_size,
     parallel_for(num_threads, [&](size_t thread_idx) {
         const size_t start = thread_idx * block_size;
         const size_t end = (thread_idx == num_threads - 1) ? circuit_size - 1 : (thread_idx + 1) * block_size;
-        for (size_t i = start; i < end; ++i) {
-            grand_product_polynomial[i + 1] = numerator[i] * denominator[i];
-        }
+        FF::mul_batch(&grand_product_polynomial[start + 1], &numerator[start], &denominator[start], end - start);
     });
 }
 
@@ -1,4 +1,5 @@
 #include "ultra_prover.hpp"
+#include "barretenberg/common/trace.hpp"
 #include "barretenberg/honk/pcs/claim.hpp"
 #include "barretenberg/honk/sumcheck/sumcheck.hpp"
 #include "barretenberg/honk/utils/power_polynomial.hpp"
@@ -29,6 +30,7 @@ UltraProver_<Flavor>::UltraProver_(std::shared_ptr<Instance> inst)
  */
 template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_preamble_round()
 {
+    BB_TRACE_SCOPE("UltraProver::execute_preamble_round");
     auto proving_key = instance->proving_key;
     const auto circuit_size = static_cast<uint32_t>(proving_key->circuit_size);
     const auto num_public_inputs = static_cast<uint32_t>(proving_key->num_public_inputs);
@@ -49,6 +51,7 @@ template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_preamble_round(
  */
 template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_wire_commitments_round()
 {
+    BB_TRACE_SCOPE("UltraProver::execute_wire_commitments_round");
     // Commit to the first three wire polynomials
     // We only commit to the fourth wire polynomial after adding memory records
     auto wire_polys = instance->proving_key->get_wires();
@@ -72,6 +75,7 @@ template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_wire_commitment
  */
 template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_sorted_list_accumulator_round()
 {
+    BB_TRACE_SCOPE("UltraProver::execute_sorted_list_accumulator_round");
     auto eta = transcript.get_challenge("eta");
 
     instance->compute_sorted_accumulator_polynomials(eta);
@@ -88,6 +92,7 @@ template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_sorted_list_acc
  */
 template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_grand_product_computation_round()
 {
+    BB_TRACE_SCOPE("UltraProver::execute_grand_product_computation_round");
     // Compute and store parameters required by relations in Sumcheck
     auto [beta, gamma] = transcript.get_challenges("beta", "gamma");
 
@@ -103,6 +108,7 @@ template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_grand_product_c
  */
 template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_relation_check_rounds()
 {
+    BB_TRACE_SCOPE("UltraProver::execute_relation_check_rounds");
     using Sumcheck = sumcheck::SumcheckProver<Flavor>;
 
     auto sumcheck = Sumcheck(instance->proving_key->circuit_size, transcript);
@@ -117,6 +123,7 @@ template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_relation_check_
  * */
 template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_univariatization_round()
 {
+    BB_TRACE_SCOPE("UltraProver::execute_univariatization_round");
     const size_t NUM_POLYNOMIALS = Flavor::NUM_ALL_ENTITIES;
 
     // Generate batching challenge ρ and powers 1,ρ,…,ρᵐ⁻¹
@@ -155,6 +162,7 @@ template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_univariatizatio
  * */
 template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_pcs_evaluation_round()
 {
+    BB_TRACE_SCOPE("UltraProver::execute_pcs_evaluation_round");
     const FF r_challenge = transcript.get_challenge("Gemini:r");
     univariate_openings = Gemini::compute_fold_polynomial_evaluations(
         sumcheck_output.challenge, std::move(gemini_polynomials), r_challenge);
@@ -177,6 +185,7 @@ template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_pcs_evaluation_
  */
 template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_op_queue_transcript_aggregation_round()
 {
+    BB_TRACE_SCOPE("UltraProver::execute_op_queue_transcript_aggregation_round");
     if constexpr (IsGoblinFlavor<Flavor>) {
         // Extract size M_{i-1} of T_{i-1} from op_queue
         size_t prev_op_queue_size = instance->proving_key->op_queue->get_previous_size(); // M_{i-1}
@@ -275,6 +284,7 @@ template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_op_queue_transc
  * */
 template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_shplonk_batched_quotient_round()
 {
+    BB_TRACE_SCOPE("UltraProver::execute_shplonk_batched_quotient_round");
     nu_challenge = transcript.get_challenge("Shplonk:nu");
 
     batched_quotient_Q = Shplonk::compute_batched_quotient(
@@ -290,6 +300,7 @@ template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_shplonk_batched
  * */
 template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_shplonk_partial_evaluation_round()
 {
+    BB_TRACE_SCOPE("UltraProver::execute_shplonk_partial_evaluation_round");
     const FF z_challenge = transcript.get_challenge("Shplonk:z");
 
     shplonk_output = Shplonk::compute_partially_evaluated_batched_quotient(univariate_openings.opening_pairs,
@@ -305,6 +316,7 @@ template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_shplonk_partial
  * */
 template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_final_pcs_round()
 {
+    BB_TRACE_SCOPE("UltraProver::execute_final_pcs_round");
     PCS::compute_opening_proof(pcs_commitment_key, shplonk_output.opening_pair, shplonk_output.witness, transcript);
     // queue.add_commitment(quotient_W, "KZG:W");
 }
@@ -317,6 +329,7 @@ template <UltraFlavor Flavor> plonk::proof& UltraProver_<Flavor>::export_proof()
 
 template <UltraFlavor Flavor> plonk::proof& UltraProver_<Flavor>::construct_proof()
 {
+    BB_TRACE_SCOPE("UltraProver::construct_proof");
     // Add circuit size public input size and public inputs to transcript.
     execute_preamble_round();
 
@@ -34,6 +34,37 @@ template <typename Flavor> UltraVerifier_<Flavor>& UltraVerifier_<Flavor>::opera
  *
  */
 template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const plonk::proof& proof)
+{
+    auto pairing_points = reduce_to_pairing_points(proof);
+    return pairing_points.has_value() &&
+           pcs_verification_key->pairing_check((*pairing_points)[0], (*pairing_points)[1]);
+}
+
+template <typename Flavor>
+bool UltraVerifier_<Flavor>::accumulate_proof(const plonk::proof& proof, PairingAccumulator& accumulator)
+{
+    auto pairing_points = reduce_to_pairing_points(proof);
+    if (!pairing_points.has_value()) {
+        return false;
+    }
+    accumulator.accumulate(*pairing_points);
+    return true;
+}
+
+template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proofs(const std::vector<plonk::proof>& proofs)
+{
+    PairingAccumulator accumulator;
+    for (const auto& proof : proofs) {
+        if (!accumulate_proof(proof, accumulator)) {
+            return false;
+        }
+    }
+    return accumulator.check(pcs_verification_key);
+}
+
+template <typename Flavor>
+std::optional<std::array<typename Flavor::GroupElement, 2>> UltraVerifier_<Flavor>::reduce_to_pairing_points(
+    const plonk::proof& proof)
 {
     using FF = typename Flavor::FF;
     using GroupElement = typename Flavor::GroupElement;
@@ -58,10 +89,10 @@ template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const plonk
     const auto pub_inputs_offset = transcript.template receive_from_prover<uint32_t>("pub_inputs_offset");
 
     if (circuit_size != key->circuit_size) {
-        return false;
+        return std::nullopt;
     }
     if (public_input_size != key->num_public_inputs) {
-        return false;
+        return std::nullopt;
     }
 
     std::vector<FF> public_inputs;
@@ -119,7 +150,7 @@ template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const plonk
 
     // If Sumcheck did not verify, return false
     if (sumcheck_verified.has_value() && !sumcheck_verified.value()) {
-        return false;
+        return std::nullopt;
     }
 
     // Execute Gemini/Shplonk verification:
@@ -142,16 +173,26 @@ template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const plonk
         ++evaluation_idx;
     }
 
+    // Add commitment * scalar to the batch, with the key's table for the commitment if there is one.
+    const auto accumulate = [&](GroupElement& batch, const Commitment& commitment, const FF& scalar) {
+        const auto* table = key->commitment_tables ? key->commitment_tables->find(commitment) : nullptr;
+        if (table != nullptr) {
+            table->accumulate(batch, scalar);
+        } else {
+            batch += commitment * scalar;
+        }
+    };
+
     // Construct batched commitment for NON-shifted polynomials
     size_t commitment_idx = 0;
     for (auto& commitment : commitments.get_unshifted()) {
-        batched_commitment_unshifted += commitment * rhos[commitment_idx];
+        accumulate(batched_commitment_unshifted, commitment, rhos[commitment_idx]);
         ++commitment_idx;
     }
 
     // Construct batched commitment for to-be-shifted polynomials
     for (auto& commitment : commitments.get_to_be_shifted()) {
-        batched_commitment_to_be_shifted += commitment * rhos[commitment_idx];
+        accumulate(batched_commitment_to_be_shifted, commitment, rhos[commitment_idx]);
         ++commitment_idx;
     }
 
@@ -194,7 +235,7 @@ template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const plonk
 
             // Check the identity T_i(\kappa) = T_{i-1}(\kappa) + t_i^{shift}(\kappa). If it fails, return false
             if (agg_op_queue_evals[idx] != prev_agg_op_queue_evals[idx] + shifted_op_wire_evals[idx]) {
-                return false;
+                return std::nullopt;
             }
         }
 
@@ -216,10 +257,13 @@ template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const plonk
     // Produce a Shplonk claim: commitment [Q] - [Q_z], evaluation zero (at random challenge z)
     auto shplonk_claim = Shplonk::reduce_verification(pcs_verification_key, univariate_opening_claims, transcript);
 
-    // Verify the Shplonk claim with KZG or IPA
-    auto verified = PCS::verify(pcs_verification_key, shplonk_claim, transcript);
+    // Reduce the Shplonk claim to the inputs of the KZG pairing check, which the caller performs or accumulates
+    auto pairing_points = PCS::compute_pairing_points(shplonk_claim, transcript);
 
-    return sumcheck_verified.value() && verified;
+    if (!sumcheck_verified.value()) {
+        return std::nullopt;
+    }
+    return pairing_points;
 }
 
 template class UltraVerifier_<honk::flavor::Ultra>;
@@ -2,8 +2,12 @@
 #include "barretenberg/honk/flavor/goblin_ultra.hpp"
 #include "barretenberg/honk/flavor/ultra.hpp"
 #include "barretenberg/honk/flavor/ultra_grumpkin.hpp"
+#include "barretenberg/honk/pcs/kzg/kzg.hpp"
 #include "barretenberg/honk/sumcheck/sumcheck.hpp"
 #include "barretenberg/plonk/proof_system/types/proof.hpp"
+#include <array>
+#include <optional>
+#include <vector>
 
 namespace proof_system::honk {
 template <typename Flavor> class UltraVerifier_ {
@@ -11,6 +15,8 @@ template <typename Flavor> class UltraVerifier_ {
     using Commitment = typename Flavor::Commitment;
     using VerificationKey = typename Flavor::VerificationKey;
     using VerifierCommitmentKey = typename Flavor::VerifierCommitmentKey;
+    using GroupElement = typename Flavor::GroupElement;
+    using PairingAccumulator = pcs::kzg::PairingAccumulator<typename Flavor::Curve>;
 
   public:
     explicit UltraVerifier_(std::shared_ptr<VerificationKey> verifier_key = nullptr);
@@ -21,6 +27,23 @@ template <typename Flavor> class UltraVerifier_ {
 
     bool verify_proof(const plonk::proof& proof);
 
+    /**
+     * @brief Verify the proof up to the final pairing check, and add its pairing points to the accumulator rather
+     * than checking them. Returns false if any of the other checks fail, in which case nothing is accumulated.
+     */
+    bool accumulate_proof(const plonk::proof& proof, PairingAccumulator& accumulator);
+
+    /**
+     * @brief Verify many proofs against the key with a single pairing, by accumulating all of them.
+     */
+    bool verify_proofs(const std::vector<plonk::proof>& proofs);
+
+    /**
+     * @brief Run the verifier up to the final pairing check, returning its inputs {P₀, P₁}, or nothing if any of the
+     * checks before it fail.
+     */
+    std::optional<std::array<GroupElement, 2>> reduce_to_pairing_points(const plonk::proof& proof);
+
     std::shared_ptr<VerificationKey> key;
     std::map<std::string, Commitment> commitments;
     std::shared_ptr<VerifierCommitmentKey> pcs_verification_key;
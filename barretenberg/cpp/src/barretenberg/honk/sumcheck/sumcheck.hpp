@@ -1,6 +1,7 @@
 #pragma once
 #include "barretenberg/common/serialize.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/common/trace.hpp"
 #include "barretenberg/honk/sumcheck/sumcheck_output.hpp"
 #include "barretenberg/honk/transcript/transcript.hpp"
 #include "barretenberg/honk/utils/grand_product_delta.hpp"
@@ -73,6 +74,7 @@ template <typename Flavor> class SumcheckProver {
         auto full_polynomials,
         const proof_system::RelationParameters<FF>& relation_parameters) // pass by value, not by reference
     {
+        BB_TRACE_SCOPE_COUNTS("sumcheck::prove", multivariate_n, 0);
         auto [alpha, zeta] = transcript.get_challenges("Sumcheck:alpha", "Sumcheck:zeta");
 
         barretenberg::PowUnivariate<FF> pow_univariate(zeta);
@@ -136,6 +138,8 @@ template <typename Flavor> class SumcheckProver {
      */
     void partially_evaluate(auto& polynomials, size_t round_size, FF round_challenge)
     {
+        BB_TRACE_SCOPE_COUNTS(
+            "sumcheck::partially_evaluate", polynomials.size() * round_size, polynomials.size() * round_size * sizeof(FF));
         // after the first round, operate in place on partially_evaluated_polynomials
         for (size_t j = 0; j < polynomials.size(); ++j) {
             for (size_t i = 0; i < round_size; i += 2) {
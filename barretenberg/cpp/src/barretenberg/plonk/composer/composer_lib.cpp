@@ -18,22 +18,43 @@ namespace proof_system::plonk {
 void compute_monomial_and_coset_selector_forms(plonk::proving_key* circuit_proving_key,
                                                std::vector<SelectorProperties> selector_properties)
 {
-    for (size_t i = 0; i < selector_properties.size(); i++) {
-        // Compute monomial form of selector polynomial
-        auto selector_poly_lagrange =
-            circuit_proving_key->polynomial_store.get(selector_properties[i].name + "_lagrange");
-        barretenberg::polynomial selector_poly(circuit_proving_key->circuit_size);
-        barretenberg::polynomial_arithmetic::ifft(
-            &selector_poly_lagrange[0], &selector_poly[0], circuit_proving_key->small_domain);
+    // The selectors are transformed together, which shares the passes over the twiddle factors between them. Under a
+    // memory budget they are instead transformed one at a time, so that the store can spill each as it is put.
+    const size_t batch_size =
+        circuit_proving_key->polynomial_store.get_memory_budget() == 0 ? selector_properties.size() : 1;
+    for (size_t first = 0; first < selector_properties.size(); first += batch_size) {
+        const size_t end = std::min(first + batch_size, selector_properties.size());
 
-        // Compute coset FFT of selector polynomial
-        barretenberg::polynomial selector_poly_fft(selector_poly, circuit_proving_key->circuit_size * 4 + 4);
-        selector_poly_fft.coset_fft(circuit_proving_key->large_domain);
+        // Compute monomial forms of the selector polynomials
+        std::vector<barretenberg::polynomial> selector_polys;
+        std::vector<barretenberg::fr*> selector_coeffs;
+        selector_polys.reserve(end - first);
+        for (size_t i = first; i < end; i++) {
+            auto selector_poly_lagrange =
+                circuit_proving_key->polynomial_store.get(selector_properties[i].name + "_lagrange");
+            selector_polys.emplace_back(selector_poly_lagrange, circuit_proving_key->circuit_size);
+            selector_coeffs.push_back(selector_polys.back().data().get());
+        }
+        barretenberg::polynomial_arithmetic::ifft_batch(selector_coeffs, circuit_proving_key->small_domain);
+
+        // Compute coset FFTs of the selector polynomials
+        std::vector<barretenberg::polynomial> selector_polys_fft;
+        std::vector<barretenberg::fr*> selector_coeffs_fft;
+        selector_polys_fft.reserve(end - first);
+        for (auto& selector_poly : selector_polys) {
+            selector_polys_fft.emplace_back(selector_poly, circuit_proving_key->circuit_size * 4 + 4);
+            selector_coeffs_fft.push_back(selector_polys_fft.back().data().get());
+        }
+        barretenberg::polynomial_arithmetic::coset_fft_batch(selector_coeffs_fft, circuit_proving_key->large_domain);
 
         // Note: For Standard, the lagrange polynomials could be removed from the store at this point but this
         // is not the case for Ultra.
-        circuit_proving_key->polynomial_store.put(selector_properties[i].name, std::move(selector_poly));
-        circuit_proving_key->polynomial_store.put(selector_properties[i].name + "_fft", std::move(selector_poly_fft));
+        for (size_t i = first; i < end; i++) {
+            circuit_proving_key->polynomial_store.put(selector_properties[i].name,
+                                                      std::move(selector_polys[i - first]));
+            circuit_proving_key->polynomial_store.put(selector_properties[i].name + "_fft",
+                                                      std::move(selector_polys_fft[i - first]));
+        }
     }
 }
 
@@ -69,6 +69,9 @@ std::shared_ptr<plonk::proving_key> StandardComposer::compute_proving_key(const
     // TODO(#392)(Kesha): replace composer types.
     circuit_proving_key = initialize_proving_key(
         circuit_constructor, crs_factory_.get(), minimum_circuit_size, num_randomized_gates, CircuitType::STANDARD);
+    if (memory_budget != 0) {
+        circuit_proving_key->polynomial_store.set_memory_budget(memory_budget, spill_directory);
+    }
     // Compute lagrange selectors
     construct_selector_polynomials<Flavor>(circuit_constructor, circuit_proving_key.get());
     // Make all selectors nonzero
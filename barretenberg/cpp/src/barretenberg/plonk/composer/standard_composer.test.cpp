@@ -4,6 +4,8 @@
 #include "barretenberg/plonk/proof_system/proving_key/serialize.hpp"
 #include "barretenberg/proof_system/circuit_builder/standard_circuit_builder.hpp"
 #include <gtest/gtest.h>
+#include <optional>
+#include <vector>
 
 using namespace barretenberg;
 using namespace proof_system;
@@ -511,3 +513,60 @@ TEST_F(StandardPlonkComposer, TestCheckCircuitBroken)
     bool result = builder.check_circuit();
     EXPECT_EQ(result, false);
 }
+
+TEST_F(StandardPlonkComposer, BatchVerification)
+{
+    constexpr size_t num_proofs = 4;
+    std::vector<plonk::proof> proofs;
+    std::optional<plonk::Verifier> verifier;
+    for (size_t i = 0; i < num_proofs; ++i) {
+        // The same circuit for each proof, with a different witness.
+        auto builder = StandardCircuitBuilder();
+        auto composer = StandardComposer();
+        fr a = fr::random_element();
+        fr b = fr::random_element();
+        uint32_t a_idx = builder.add_public_variable(a);
+        uint32_t b_idx = builder.add_variable(b);
+        uint32_t c_idx = builder.add_variable(a * b);
+        builder.create_mul_gate({ a_idx, b_idx, c_idx, fr::one(), fr::neg_one(), fr::zero() });
+
+        auto prover = composer.create_prover(builder);
+        proofs.emplace_back(prover.construct_proof());
+        if (i == 0) {
+            verifier.emplace(composer.create_verifier(builder));
+        }
+    }
+
+    EXPECT_TRUE(verifier->verify_proofs(proofs));
+    EXPECT_TRUE(verifier->find_invalid_proofs(proofs).empty());
+
+    // Change the public input of one proof, which leaves it well-formed but invalid.
+    proofs[2].proof_data[31] ^= 1;
+    EXPECT_FALSE(verifier->verify_proofs(proofs));
+    EXPECT_EQ(verifier->find_invalid_proofs(proofs), std::vector<size_t>{ 2 });
+    EXPECT_TRUE(verifier->verify_proof(proofs[3]));
+}
+
+TEST_F(StandardPlonkComposer, CommitmentTables)
+{
+    auto builder = StandardCircuitBuilder();
+    auto composer = StandardComposer();
+    fr a = fr::random_element();
+    fr b = fr::random_element();
+    uint32_t a_idx = builder.add_public_variable(a);
+    uint32_t b_idx = builder.add_variable(b);
+    uint32_t c_idx = builder.add_variable(a * b);
+    builder.create_mul_gate({ a_idx, b_idx, c_idx, fr::one(), fr::neg_one(), fr::zero() });
+
+    auto prover = composer.create_prover(builder);
+    auto proof = prover.construct_proof();
+    auto verifier = composer.create_verifier(builder);
+
+    verifier.key->precompute_commitment_tables(/*window_bits=*/4);
+    EXPECT_EQ(verifier.key->commitment_tables->size(), verifier.key->commitments.size());
+    EXPECT_TRUE(verifier.verify_proof(proof));
+    EXPECT_TRUE(verifier.verify_proofs({ proof, proof }));
+
+    proof.proof_data[31] ^= 1;
+    EXPECT_FALSE(verifier.verify_proof(proof));
+}
@@ -75,49 +75,23 @@ void UltraComposer::compute_witness(CircuitBuilder& circuit_constructor)
         s_4[i] = 0;
     }
 
-    for (auto& table : circuit_constructor.lookup_tables) {
+    for (const auto& table : circuit_constructor.lookup_tables) {
         const fr table_index(table.table_index);
-        auto& lookup_gates = table.lookup_gates;
+        // The sorted list holds each row of the table once, plus once for each lookup of it, in the order of the table.
+        // So it is a counting sort of the rows looked up, in time linear in the size of the table and the lookups.
+        std::vector<uint32_t> row_counts(table.size, 1);
+        for (const auto row : table.lookup_gates) {
+            ++row_counts[row];
+        }
         for (size_t i = 0; i < table.size; ++i) {
-            if (table.use_twin_keys) {
-                lookup_gates.push_back({
-                    {
-                        table.column_1[i].from_montgomery_form().data[0],
-                        table.column_2[i].from_montgomery_form().data[0],
-                    },
-                    {
-                        table.column_3[i],
-                        0,
-                    },
-                });
-            } else {
-                lookup_gates.push_back({
-                    {
-                        table.column_1[i].from_montgomery_form().data[0],
-                        0,
-                    },
-                    {
-                        table.column_2[i],
-                        table.column_3[i],
-                    },
-                });
+            for (uint32_t j = 0; j < row_counts[i]; ++j) {
+                s_1[count] = table.column_1[i];
+                s_2[count] = table.column_2[i];
+                s_3[count] = table.column_3[i];
+                s_4[count] = table_index;
+                ++count;
             }
         }
-
-#ifdef NO_TBB
-        std::sort(lookup_gates.begin(), lookup_gates.end());
-#else
-        std::sort(std::execution::par_unseq, lookup_gates.begin(), lookup_gates.end());
-#endif
-
-        for (const auto& entry : lookup_gates) {
-            const auto components = entry.to_sorted_list_components(table.use_twin_keys);
-            s_1[count] = components[0];
-            s_2[count] = components[1];
-            s_3[count] = components[2];
-            s_4[count] = table_index;
-            ++count;
-        }
     }
 
     // Initialise the `s_randomness` positions in the s polynomials with 0.
@@ -379,6 +353,9 @@ std::shared_ptr<proving_key> UltraComposer::compute_proving_key(CircuitBuilder&
     // TODO(#392)(Kesha): replace composer types.
     circuit_proving_key = initialize_proving_key(
         circuit_constructor, crs_factory_.get(), minimum_circuit_size, num_randomized_gates, CircuitType::ULTRA);
+    if (memory_budget != 0) {
+        circuit_proving_key->polynomial_store.set_memory_budget(memory_budget, spill_directory);
+    }
 
     construct_selector_polynomials<Flavor>(circuit_constructor, circuit_proving_key.get());
 
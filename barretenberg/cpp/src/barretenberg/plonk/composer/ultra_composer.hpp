@@ -1,5 +1,6 @@
 #pragma once
 
+#include "barretenberg/common/memory_policy.hpp"
 #include "barretenberg/plonk/composer/composer_lib.hpp"
 #include "barretenberg/plonk/flavor/flavor.hpp"
 #include "barretenberg/plonk/proof_system/prover/prover.hpp"
@@ -10,6 +11,7 @@
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
 
 #include <cstddef>
+#include <string>
 #include <utility>
 
 namespace proof_system::plonk {
@@ -31,6 +33,10 @@ class UltraComposer {
 
     bool computed_witness = false;
 
+    // Bound on the memory held by the polynomials of the proving key, in bytes. 0 means unbounded.
+    size_t memory_budget = 0;
+    std::string spill_directory;
+
     // This variable controls the amount with which the lookup table and witness values need to be shifted
     // above to make room for adding randomness into the permutation and witness polynomials in the plookup widget.
     // This must be (num_roots_cut_out_of_the_vanishing_polynomial - 1), since the variable num_roots_cut_out_of_
@@ -75,6 +81,25 @@ class UltraComposer {
 
     [[nodiscard]] size_t get_num_selectors() { return ultra_selector_properties().size(); }
 
+    /**
+     * @brief Prove within the given memory budget (bytes, 0 for unbounded). Polynomials of the proving key beyond the
+     * budget are spilled to spill_dir (default: $TMPDIR) and read back when next needed.
+     */
+    void set_memory_budget(size_t bytes, std::string const& spill_dir = "")
+    {
+        memory_budget = bytes;
+        spill_directory = spill_dir;
+        if (circuit_proving_key) {
+            circuit_proving_key->polynomial_store.set_memory_budget(memory_budget, spill_directory);
+        }
+    }
+
+    /**
+     * @brief Set how the pages of large buffers are placed across NUMA nodes. This is process-wide: it applies to every
+     * composer, and to all buffers allocated from now on.
+     */
+    static void set_memory_policy(barretenberg::MemoryPolicy policy) { barretenberg::set_memory_policy(policy); }
+
     std::shared_ptr<plonk::proving_key> compute_proving_key(CircuitBuilder& circuit_constructor);
     std::shared_ptr<plonk::verification_key> compute_verification_key(CircuitBuilder& circuit_constructor);
 
@@ -169,6 +169,31 @@ TYPED_TEST(ultra_plonk_composer, test_no_lookup_proof)
     TestFixture::prove_and_verify(builder, composer, /*expected_result=*/true);
 }
 
+TYPED_TEST(ultra_plonk_composer, test_memory_budget_proof)
+{
+    auto builder = UltraCircuitBuilder();
+    auto composer = UltraComposer();
+
+    for (size_t i = 0; i < 256; ++i) {
+        uint32_t left_idx = builder.add_variable(fr::random_element());
+        uint32_t right_idx = builder.add_variable(fr::random_element());
+        uint32_t product_idx = builder.add_variable(builder.get_variable(left_idx) * builder.get_variable(right_idx));
+        builder.create_mul_gate({ left_idx, right_idx, product_idx, fr(1), fr(-1), fr(0) });
+    }
+
+    // A budget smaller than any one polynomial forces everything not in use out to disk.
+    composer.set_memory_budget(1);
+    TestFixture::prove_and_verify(builder, composer, /*expected_result=*/true);
+
+    size_t num_spilled = 0;
+    for (auto& label : { "q_m", "q_m_fft", "sigma_1", "sigma_1_fft" }) {
+        num_spilled += composer.circuit_proving_key->polynomial_store.is_spilled(label) ? 1UL : 0UL;
+    }
+    EXPECT_GT(num_spilled, 0);
+    // The witness coset FFTs are freed once the quotient polynomial has been computed.
+    EXPECT_FALSE(composer.circuit_proving_key->polynomial_store.contains("w_1_fft"));
+}
+
 TYPED_TEST(ultra_plonk_composer, test_elliptic_gate)
 {
     typedef grumpkin::g1::affine_element affine_element;
@@ -1,5 +1,6 @@
 #include "prover.hpp"
 #include "../public_inputs/public_inputs.hpp"
+#include "barretenberg/common/trace.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/plonk/proof_system/types/prover_settings.hpp"
 #include "barretenberg/polynomials/iterate_over_domain.hpp"
@@ -156,6 +157,7 @@ template <typename settings> void ProverBase<settings>::compute_quotient_commitm
  * */
 template <typename settings> void ProverBase<settings>::execute_preamble_round()
 {
+    BB_TRACE_SCOPE("Prover::execute_preamble_round");
     queue.flush_queue();
 
     transcript.add_element("circuit_size",
@@ -236,6 +238,7 @@ template <typename settings> void ProverBase<settings>::execute_preamble_round()
  * */
 template <typename settings> void ProverBase<settings>::execute_first_round()
 {
+    BB_TRACE_SCOPE("Prover::execute_first_round");
     queue.flush_queue();
 #ifdef DEBUG_TIMING
     std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
@@ -279,6 +282,7 @@ template <typename settings> void ProverBase<settings>::execute_first_round()
  * */
 template <typename settings> void ProverBase<settings>::execute_second_round()
 {
+    BB_TRACE_SCOPE("Prover::execute_second_round");
     queue.flush_queue();
 
     transcript.apply_fiat_shamir("eta");
@@ -332,6 +336,7 @@ template <typename settings> void ProverBase<settings>::execute_second_round()
  * */
 template <typename settings> void ProverBase<settings>::execute_third_round()
 {
+    BB_TRACE_SCOPE("Prover::execute_third_round");
     queue.flush_queue();
 
     transcript.apply_fiat_shamir("beta");
@@ -357,6 +362,7 @@ template <typename settings> void ProverBase<settings>::execute_third_round()
  */
 template <typename settings> void ProverBase<settings>::execute_fourth_round()
 {
+    BB_TRACE_SCOPE("Prover::execute_fourth_round");
     queue.flush_queue();
     transcript.apply_fiat_shamir("alpha");
     fr alpha_base = fr::serialize_from_buffer(transcript.get_challenge("alpha").begin());
@@ -372,6 +378,8 @@ template <typename settings> void ProverBase<settings>::execute_fourth_round()
         alpha_base = widget->compute_quotient_contribution(alpha_base, transcript);
     }
 
+    release_witness_coset_polynomials();
+
     // The parts of the quotient polynomial t(X) are stored as 4 separate polynomials in
     // the code. However, operations such as dividing by the pseudo vanishing polynomial
     // as well as iFFT (coset) are to be performed on the polynomial t(X) as a whole.
@@ -401,6 +409,7 @@ template <typename settings> void ProverBase<settings>::execute_fourth_round()
 
 template <typename settings> void ProverBase<settings>::execute_fifth_round()
 {
+    BB_TRACE_SCOPE("Prover::execute_fifth_round");
     queue.flush_queue();
     transcript.apply_fiat_shamir("z"); // end of 4th round
 #ifdef DEBUG_TIMING
@@ -416,6 +425,7 @@ template <typename settings> void ProverBase<settings>::execute_fifth_round()
 
 template <typename settings> void ProverBase<settings>::execute_sixth_round()
 {
+    BB_TRACE_SCOPE("Prover::execute_sixth_round");
     queue.flush_queue();
     transcript.apply_fiat_shamir("nu");
     commitment_scheme->batch_open(transcript, queue, key);
@@ -486,6 +496,24 @@ template <typename settings> void ProverBase<settings>::compute_lagrange_1_fft()
     key->polynomial_store.put("lagrange_1_fft", std::move(lagrange_1_fft));
 }
 
+/**
+ * @brief Free the coset FFTs of the witness-derived polynomials, which are last used by the quotient computation.
+ * @details The coset FFTs of the precomputed polynomials are left in place, as they're part of the proving key and
+ * will be needed for the next proof. They may still be spilled, if the proving key has a memory budget.
+ */
+template <typename settings> void ProverBase<settings>::release_witness_coset_polynomials()
+{
+    std::vector<std::string> tags = { "z_perm_fft", "z_lookup_fft", "s_fft", "lagrange_1_fft" };
+    for (size_t i = 0; i < settings::program_width; ++i) {
+        tags.push_back("w_" + std::to_string(i + 1) + "_fft");
+    }
+    for (auto& tag : tags) {
+        if (key->polynomial_store.contains(tag)) {
+            key->polynomial_store.remove(tag);
+        }
+    }
+}
+
 template <typename settings> plonk::proof& ProverBase<settings>::export_proof()
 {
     proof.proof_data = transcript.export_transcript();
@@ -494,6 +522,7 @@ template <typename settings> plonk::proof& ProverBase<settings>::export_proof()
 
 template <typename settings> plonk::proof& ProverBase<settings>::construct_proof()
 {
+    BB_TRACE_SCOPE("Prover::construct_proof");
     // Execute init round. Randomize witness polynomials.
     // info("preamble");
     execute_preamble_round();
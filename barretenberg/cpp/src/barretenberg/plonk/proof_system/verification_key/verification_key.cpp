@@ -123,6 +123,7 @@ verification_key::verification_key(const verification_key& other)
     , polynomial_manifest(other.polynomial_manifest)
     , contains_recursive_proof(other.contains_recursive_proof)
     , recursive_proof_public_input_indices(other.recursive_proof_public_input_indices)
+    , commitment_tables(other.commitment_tables)
 {}
 
 verification_key::verification_key(verification_key&& other)
@@ -136,6 +137,7 @@ verification_key::verification_key(verification_key&& other)
     , polynomial_manifest(other.polynomial_manifest)
     , contains_recursive_proof(other.contains_recursive_proof)
     , recursive_proof_public_input_indices(other.recursive_proof_public_input_indices)
+    , commitment_tables(other.commitment_tables)
 {}
 
 verification_key& verification_key::operator=(verification_key&& other)
@@ -150,9 +152,20 @@ verification_key& verification_key::operator=(verification_key&& other)
     domain = std::move(other.domain);
     contains_recursive_proof = (other.contains_recursive_proof);
     recursive_proof_public_input_indices = std::move(other.recursive_proof_public_input_indices);
+    commitment_tables = std::move(other.commitment_tables);
     return *this;
 }
 
+void verification_key::precompute_commitment_tables(size_t window_bits)
+{
+    std::vector<barretenberg::g1::affine_element> bases;
+    bases.reserve(commitments.size());
+    for (const auto& [label, commitment] : commitments) {
+        bases.emplace_back(commitment);
+    }
+    commitment_tables = std::make_shared<const CommitmentTables>(bases, window_bits);
+}
+
 sha256::hash verification_key::sha256_hash()
 {
     std::vector<uint256_t> vk_data;
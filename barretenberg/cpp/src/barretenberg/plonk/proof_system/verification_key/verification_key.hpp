@@ -3,6 +3,7 @@
 #include "barretenberg/crypto/sha256/sha256.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_table.hpp"
 #include "barretenberg/plonk/proof_system/types/polynomial_manifest.hpp"
 #include "barretenberg/polynomials/evaluation_domain.hpp"
 #include "barretenberg/serialize/msgpack.hpp"
@@ -46,6 +47,8 @@ inline bool operator==(verification_key_data const& lhs, verification_key_data c
 }
 
 struct verification_key {
+    using CommitmentTables = barretenberg::scalar_multiplication::FixedBaseTables<curve::BN254>;
+
     // default constructor needed for msgpack unpack
     verification_key() = default;
     verification_key(verification_key_data&& data,
@@ -63,6 +66,14 @@ struct verification_key {
 
     sha256::hash sha256_hash();
 
+    /**
+     * @brief Precompute fixed-base tables for the commitments, with which the verifier computes its scalar
+     * multiplications by them using only additions. Worth it for a key which verifies many proofs: each table takes
+     * (2^w - 1).⌈254 / w⌉ points of memory (170 KB for the default w = 6).
+     */
+    void precompute_commitment_tables(
+        size_t window_bits = barretenberg::scalar_multiplication::FixedBaseTable<curve::BN254>::DEFAULT_WINDOW_BITS);
+
     verification_key_data as_data() const
     {
         return {
@@ -96,6 +107,9 @@ struct verification_key {
     std::vector<uint32_t> recursive_proof_public_input_indices;
     size_t program_width = 3;
 
+    // Optional; not serialized. Shared by copies of the key, as the commitments don't change.
+    std::shared_ptr<const CommitmentTables> commitment_tables;
+
     // for serialization: update with new fields
     void msgpack_pack(auto& packer) const
     {
@@ -11,6 +11,64 @@
 using namespace barretenberg;
 
 namespace proof_system::plonk {
+
+namespace {
+
+/**
+ * @brief Σ scalars[i].elements[i], for elements which aren't the point at infinity. Terms whose element has a
+ * precomputed table (the verification key's commitments) are computed with it, the rest with pippenger. Overwrites the
+ * scalars and elements.
+ */
+g1::element multi_scalar_mul(std::vector<fr>& scalars,
+                             std::vector<g1::affine_element>& elements,
+                             const verification_key::CommitmentTables* tables = nullptr)
+{
+    g1::element result = g1::element::infinity();
+    size_t num_elements = elements.size();
+    if (tables != nullptr) {
+        size_t num_remaining = 0;
+        for (size_t i = 0; i < num_elements; ++i) {
+            if (const auto* table = tables->find(elements[i])) {
+                table->accumulate(result, scalars[i]);
+            } else {
+                scalars[num_remaining] = scalars[i];
+                elements[num_remaining] = elements[i];
+                ++num_remaining;
+            }
+        }
+        num_elements = num_remaining;
+    }
+    if (num_elements == 0) {
+        return result;
+    }
+    elements.resize(num_elements * 2);
+    barretenberg::scalar_multiplication::generate_pippenger_point_table<curve::BN254>(
+        &elements[0], &elements[0], num_elements);
+    scalar_multiplication::pippenger_runtime_state<curve::BN254> state(num_elements);
+    return result + barretenberg::scalar_multiplication::pippenger<curve::BN254>(
+                        &scalars[0], &elements[0], num_elements, state);
+}
+
+/**
+ * @brief The final pairing check of step 12, e(P[0], [x]_2).e(P[1], [1]_2) = 1.
+ */
+bool final_pairing_check(g1::element P[2], const std::shared_ptr<verification_key>& key)
+{
+    g1::element::batch_normalize(P, 2);
+
+    g1::affine_element P_affine[2]{
+        { P[0].x, P[0].y },
+        { P[1].x, P[1].y },
+    };
+
+    barretenberg::fq12 result = barretenberg::pairing::reduced_ate_pairing_batch_precomputed(
+        P_affine, key->reference_string->get_precomputed_g2_lines(), 2);
+
+    return (result == barretenberg::fq12::one());
+}
+
+} // namespace
+
 template <typename program_settings>
 VerifierBase<program_settings>::VerifierBase(std::shared_ptr<verification_key> verifier_key,
                                              const transcript::Manifest& input_manifest)
@@ -36,7 +94,9 @@ VerifierBase<program_settings>& VerifierBase<program_settings>::operator=(Verifi
     return *this;
 }
 
-template <typename program_settings> bool VerifierBase<program_settings>::verify_proof(const plonk::proof& proof)
+template <typename program_settings>
+typename VerifierBase<program_settings>::PairingInputs VerifierBase<program_settings>::compute_pairing_inputs(
+    const plonk::proof& proof)
 {
     // This function verifies a PLONK proof for given program settings.
     // A PLONK proof for standard PLONK is of the form:
@@ -49,6 +109,10 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
 
     key->program_width = program_settings::program_width;
 
+    // The widgets accumulate into these, so clear those of any previous proof.
+    kate_g1_elements.clear();
+    kate_fr_elements.clear();
+
     // Add the proof data to the transcript, according to the manifest. Also initialise the transcript's hash type and
     // challenge bytes.
     transcript::StandardTranscript transcript = transcript::StandardTranscript(
@@ -163,27 +227,18 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
     kate_g1_elements.insert({ "PI_Z", PI_Z });
     kate_fr_elements.insert({ "PI_Z", zeta });
 
-    std::vector<fr> scalars;
-    std::vector<g1::affine_element> elements;
-
-    for (const auto& [key, value] : kate_g1_elements) {
+    PairingInputs result;
+    for (const auto& [label, value] : kate_g1_elements) {
         // TODO: perhaps we should throw if not on curve or if infinity?
         if (value.on_curve() && !value.is_point_at_infinity()) {
-            scalars.emplace_back(kate_fr_elements.at(key));
-            elements.emplace_back(value);
+            result.labels.emplace_back(label);
+            result.scalars.emplace_back(kate_fr_elements.at(label));
+            result.elements.emplace_back(value);
         }
     }
-
-    size_t num_elements = elements.size();
-    elements.resize(num_elements * 2);
-    barretenberg::scalar_multiplication::generate_pippenger_point_table<curve::BN254>(
-        &elements[0], &elements[0], num_elements);
-    scalar_multiplication::pippenger_runtime_state<curve::BN254> state(num_elements);
-
-    g1::element P[2];
-
-    P[0] = barretenberg::scalar_multiplication::pippenger<curve::BN254>(&scalars[0], &elements[0], num_elements, state);
-    P[1] = -(g1::element(PI_Z_OMEGA) * separator_challenge + PI_Z);
+    result.separator_challenge = separator_challenge;
+    result.PI_Z = PI_Z;
+    result.PI_Z_OMEGA = PI_Z_OMEGA;
 
     if (key->contains_recursive_proof) {
         ASSERT(key->recursive_proof_public_input_indices.size() == 16);
@@ -220,22 +275,115 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
                                                       key->recursive_proof_public_input_indices[14],
                                                       key->recursive_proof_public_input_indices[15]);
 
-        P[0] += g1::element(x0, y0, 1) * recursion_separator_challenge;
-        P[1] += g1::element(x1, y1, 1) * recursion_separator_challenge;
+        result.contains_recursive_proof = true;
+        result.recursion_lhs = g1::element(x0, y0, 1) * recursion_separator_challenge;
+        result.recursion_rhs = g1::element(x1, y1, 1) * recursion_separator_challenge;
     }
+    return result;
+}
 
-    g1::element::batch_normalize(P, 2);
+template <typename program_settings> bool VerifierBase<program_settings>::verify_proof(const plonk::proof& proof)
+{
+    PairingInputs inputs = compute_pairing_inputs(proof);
 
-    g1::affine_element P_affine[2]{
-        { P[0].x, P[0].y },
-        { P[1].x, P[1].y },
-    };
+    g1::element P[2];
 
-    // The final pairing check of step 12.
-    barretenberg::fq12 result = barretenberg::pairing::reduced_ate_pairing_batch_precomputed(
-        P_affine, key->reference_string->get_precomputed_g2_lines(), 2);
+    P[0] = multi_scalar_mul(inputs.scalars, inputs.elements, key->commitment_tables.get());
+    P[1] = -(g1::element(inputs.PI_Z_OMEGA) * inputs.separator_challenge + inputs.PI_Z);
 
-    return (result == barretenberg::fq12::one());
+    if (inputs.contains_recursive_proof) {
+        P[0] += inputs.recursion_lhs;
+        P[1] += inputs.recursion_rhs;
+    }
+
+    return final_pairing_check(P, key);
+}
+
+template <typename program_settings>
+bool VerifierBase<program_settings>::verify_proofs(const std::vector<plonk::proof>& proofs)
+{
+    if (proofs.empty()) {
+        return true;
+    }
+
+    std::vector<fr> lhs_scalars;
+    std::vector<g1::affine_element> lhs_elements;
+    // The position in lhs_elements of the latest element with each label.
+    std::map<std::string, size_t> lhs_positions;
+    std::vector<fr> rhs_scalars;
+    std::vector<g1::affine_element> rhs_elements;
+    g1::element recursion_lhs = g1::element::infinity();
+    g1::element recursion_rhs = g1::element::infinity();
+    bool contains_recursive_proof = false;
+
+    for (size_t i = 0; i < proofs.size(); ++i) {
+        PairingInputs inputs = compute_pairing_inputs(proofs[i]);
+        // Scaling the first proof is redundant, the others' randomizers already separate it from them.
+        const fr randomizer = i == 0 ? fr::one() : fr::random_element();
+
+        for (size_t j = 0; j < inputs.elements.size(); ++j) {
+            const fr scalar = inputs.scalars[j] * randomizer;
+            auto [position, inserted] = lhs_positions.try_emplace(inputs.labels[j], lhs_elements.size());
+            if (!inserted && lhs_elements[position->second] == inputs.elements[j]) {
+                lhs_scalars[position->second] += scalar;
+            } else {
+                position->second = lhs_elements.size();
+                lhs_scalars.emplace_back(scalar);
+                lhs_elements.emplace_back(inputs.elements[j]);
+            }
+        }
+
+        rhs_scalars.emplace_back(-randomizer);
+        rhs_elements.emplace_back(inputs.PI_Z);
+        if (!inputs.PI_Z_OMEGA.is_point_at_infinity()) {
+            rhs_scalars.emplace_back(-(inputs.separator_challenge * randomizer));
+            rhs_elements.emplace_back(inputs.PI_Z_OMEGA);
+        }
+
+        if (inputs.contains_recursive_proof) {
+            contains_recursive_proof = true;
+            recursion_lhs += inputs.recursion_lhs * randomizer;
+            recursion_rhs += inputs.recursion_rhs * randomizer;
+        }
+    }
+
+    g1::element P[2];
+
+    P[0] = multi_scalar_mul(lhs_scalars, lhs_elements, key->commitment_tables.get());
+    P[1] = multi_scalar_mul(rhs_scalars, rhs_elements);
+
+    if (contains_recursive_proof) {
+        P[0] += recursion_lhs;
+        P[1] += recursion_rhs;
+    }
+
+    return final_pairing_check(P, key);
+}
+
+template <typename program_settings>
+std::vector<size_t> VerifierBase<program_settings>::find_invalid_proofs(const std::vector<plonk::proof>& proofs)
+{
+#ifndef __wasm__
+    const auto succeeds = [](const auto& check) {
+        try {
+            return check();
+        } catch (const std::exception&) {
+            return false;
+        }
+    };
+#else
+    const auto succeeds = [](const auto& check) { return check(); };
+#endif
+    if (succeeds([&] { return verify_proofs(proofs); })) {
+        return {};
+    }
+    std::vector<size_t> invalid_proofs;
+    for (size_t i = 0; i < proofs.size(); ++i) {
+        if (!succeeds([&] { return verify_proof(proofs[i]); })) {
+            invalid_proofs.emplace_back(i);
+        }
+    }
+    return invalid_proofs;
 }
 
 template class VerifierBase<standard_verifier_settings>;
@@ -19,7 +19,48 @@ template <typename program_settings> class VerifierBase {
     bool validate_commitments();
     bool validate_scalars();
 
+    /**
+     * @brief The inputs to the final pairing check of a proof, e(P_0, [x]_2).e(P_1, [1]_2) = 1, before the MSMs which
+     * give P_0 and P_1 are computed, so that those of many proofs can be combined.
+     */
+    struct PairingInputs {
+        // P_0 = Σ scalars[i].elements[i] + recursion_lhs, with elements labelled as in kate_g1_elements.
+        std::vector<std::string> labels;
+        std::vector<barretenberg::fr> scalars;
+        std::vector<barretenberg::g1::affine_element> elements;
+        // P_1 = -(separator_challenge.[W_zω]_1 + [W_z]_1) + recursion_rhs
+        barretenberg::fr separator_challenge;
+        barretenberg::g1::affine_element PI_Z;
+        barretenberg::g1::affine_element PI_Z_OMEGA;
+        // The pairing inputs of a recursive proof held in the public inputs, scaled by the recursion separator.
+        bool contains_recursive_proof = false;
+        barretenberg::g1::element recursion_lhs;
+        barretenberg::g1::element recursion_rhs;
+    };
+
+    /**
+     * @brief Run the verifier up to the final pairing check. Throws if the proof is malformed.
+     */
+    PairingInputs compute_pairing_inputs(const plonk::proof& proof);
+
     bool verify_proof(const plonk::proof& proof);
+
+    /**
+     * @brief Verify many proofs against the key with a single pairing.
+     *
+     * @details The pairing inputs of each proof are scaled by a random challenge and summed, so the check fails with
+     * overwhelming probability if any of the proofs is invalid. Commitments from the verification key, and [1]_1, are
+     * shared by all of the proofs, so their scalars are summed and they appear once in the MSM for P_0. Returns true
+     * for an empty batch; use find_invalid_proofs to tell which proofs of a failing batch are bad.
+     */
+    bool verify_proofs(const std::vector<plonk::proof>& proofs);
+
+    /**
+     * @brief The indices of the proofs which don't verify. Checks the whole batch at once first, and each proof on its
+     * own only if that fails. Outside of WASM, malformed proofs count as invalid rather than throwing.
+     */
+    std::vector<size_t> find_invalid_proofs(const std::vector<plonk::proof>& proofs);
+
     transcript::Manifest manifest;
 
     std::shared_ptr<verification_key> key;
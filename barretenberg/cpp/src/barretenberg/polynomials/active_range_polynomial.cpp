@@ -0,0 +1,176 @@
+#include "active_range_polynomial.hpp"
+#include "barretenberg/common/slab_allocator.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "polynomial_arithmetic.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace barretenberg {
+
+template <typename Fr>
+ActiveRangePolynomial<Fr>::ActiveRangePolynomial(const size_t size, const size_t start, const size_t end)
+    : size_(size)
+    , start_(start)
+    , end_(end)
+{
+    ASSERT(start <= end && end <= size);
+    if (active_size() > 0) {
+        coefficients_ = std::static_pointer_cast<Fr[]>(get_mem_slab(sizeof(Fr) * active_size()));
+        memset(static_cast<void*>(coefficients_.get()), 0, sizeof(Fr) * active_size());
+    }
+}
+
+template <typename Fr>
+ActiveRangePolynomial<Fr>::ActiveRangePolynomial(std::span<const Fr> coefficients)
+    : ActiveRangePolynomial(coefficients.size(),
+                            find_active_range(coefficients).first,
+                            find_active_range(coefficients).second)
+{
+    if (active_size() > 0) {
+        std::copy_n(&coefficients[start_], active_size(), coefficients_.get());
+    }
+}
+
+template <typename Fr>
+std::pair<size_t, size_t> ActiveRangePolynomial<Fr>::find_active_range(std::span<const Fr> coefficients)
+{
+    size_t end = coefficients.size();
+    while (end > 0 && coefficients[end - 1].is_zero()) {
+        --end;
+    }
+    size_t start = 0;
+    while (start < end && coefficients[start].is_zero()) {
+        ++start;
+    }
+    return { start == end ? 0 : start, end };
+}
+
+template <typename Fr> bool ActiveRangePolynomial<Fr>::operator==(ActiveRangePolynomial const& rhs) const
+{
+    if (size_ != rhs.size_) {
+        return false;
+    }
+    // Compare over the union of the active ranges, as either may hold explicit zeros.
+    const size_t start = std::min(start_, rhs.start_);
+    const size_t end = std::max(end_, rhs.end_);
+    for (size_t i = start; i < end; ++i) {
+        if ((*this)[i] != rhs[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Fr> ActiveRangePolynomial<Fr> ActiveRangePolynomial<Fr>::shifted() const
+{
+    ASSERT(size_ > 0);
+    ActiveRangePolynomial result;
+    result.size_ = size_;
+    if (active_size() == 0) {
+        return result;
+    }
+    if (start_ > 0) {
+        result.coefficients_ = coefficients_;
+        result.start_ = start_ - 1;
+        result.end_ = end_ - 1;
+    } else {
+        ASSERT(coefficients_[0].is_zero());
+        // Alias the buffer from its second element on.
+        result.coefficients_ = pointer(coefficients_, coefficients_.get() + 1);
+        result.start_ = 0;
+        result.end_ = end_ - 1;
+    }
+    return result;
+}
+
+template <typename Fr> Polynomial<Fr> ActiveRangePolynomial<Fr>::to_dense() const
+{
+    Polynomial<Fr> result(size_);
+    std::copy_n(coefficients_.get(), active_size(), &result[start_]);
+    return result;
+}
+
+template <typename Fr> Fr ActiveRangePolynomial<Fr>::evaluate(const Fr& z) const
+{
+    return z.pow(static_cast<uint64_t>(start_)) *
+           polynomial_arithmetic::evaluate(coefficients_.get(), z, active_size());
+}
+
+template <typename Fr>
+Fr ActiveRangePolynomial<Fr>::evaluate_mle(std::span<const Fr> evaluation_points, bool shift) const
+{
+    if (shift) {
+        return shifted().evaluate_mle(evaluation_points);
+    }
+    ASSERT(size_ == static_cast<size_t>(1) << evaluation_points.size());
+    if (evaluation_points.empty()) {
+        return (*this)[0];
+    }
+    ActiveRangePolynomial folded = partially_evaluate(evaluation_points[0]);
+    for (size_t l = 1; l < evaluation_points.size(); ++l) {
+        folded = folded.partially_evaluate(evaluation_points[l]);
+    }
+    return folded[0];
+}
+
+template <typename Fr>
+ActiveRangePolynomial<Fr> ActiveRangePolynomial<Fr>::partially_evaluate(const Fr& challenge) const
+{
+    ASSERT(size_ % 2 == 0);
+    if (active_size() == 0) {
+        return ActiveRangePolynomial(size_ / 2, 0, 0);
+    }
+    ActiveRangePolynomial result(size_ / 2, start_ / 2, (end_ + 1) / 2);
+    Fr* out = result.coefficients_.get();
+    const size_t result_start = result.start_;
+    const size_t num_threads = std::min(get_num_cpus(), result.active_size());
+    parallel_for(num_threads, [&](size_t j) {
+        const size_t start = (j * result.active_size()) / num_threads;
+        const size_t end = ((j + 1) * result.active_size()) / num_threads;
+        for (size_t i = start; i < end; ++i) {
+            const size_t index = (result_start + i) << 1;
+            const Fr even = (*this)[index];
+            out[i] = even + challenge * ((*this)[index + 1] - even);
+        }
+    });
+    return result;
+}
+
+template <typename Fr>
+Polynomial<Fr> ActiveRangePolynomial<Fr>::fft(const EvaluationDomain<Fr>& domain) const
+    requires polynomial_arithmetic::SupportsFFT<Fr>
+{
+    ASSERT(size_ <= domain.size);
+    Polynomial<Fr> result(domain.size);
+    std::copy_n(coefficients_.get(), active_size(), &result[start_]);
+    polynomial_arithmetic::fft(result.data().get(), domain);
+    return result;
+}
+
+template <typename Fr>
+Polynomial<Fr> ActiveRangePolynomial<Fr>::coset_fft(const EvaluationDomain<Fr>& domain) const
+    requires polynomial_arithmetic::SupportsFFT<Fr>
+{
+    ASSERT(size_ <= domain.size);
+    Polynomial<Fr> result(domain.size);
+    // As polynomial_arithmetic::coset_fft, only the first generator_size coefficients are scaled.
+    const size_t scaled_end = std::clamp(domain.generator_size, start_, end_);
+    const size_t num_threads = std::min(domain.num_threads, active_size());
+    parallel_for(num_threads, [&](size_t j) {
+        const size_t start = (j * active_size()) / num_threads;
+        const size_t end = ((j + 1) * active_size()) / num_threads;
+        Fr work_generator = domain.generator.pow(static_cast<uint64_t>(start_ + start));
+        for (size_t i = start; i < end; ++i) {
+            const size_t index = start_ + i;
+            result[index] = index < scaled_end ? coefficients_.get()[i] * work_generator : coefficients_.get()[i];
+            work_generator *= domain.generator;
+        }
+    });
+    polynomial_arithmetic::fft(result.data().get(), domain);
+    return result;
+}
+
+template class ActiveRangePolynomial<barretenberg::fr>;
+template class ActiveRangePolynomial<grumpkin::fr>;
+
+} // namespace barretenberg
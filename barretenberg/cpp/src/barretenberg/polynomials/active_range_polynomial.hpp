@@ -0,0 +1,109 @@
+#pragma once
+#include "barretenberg/common/assert.hpp"
+#include "evaluation_domain.hpp"
+#include "polynomial.hpp"
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <utility>
+
+namespace barretenberg {
+
+/**
+ * @brief A polynomial of a given size whose coefficients are zero outside of an active range [start, end).
+ *
+ * @details Many columns are non-zero on only a few rows: Lagrange first/last, public input and lookup selectors,
+ * lookup tables, ecc op wires. Only the coefficients of the active range are allocated, and the operations below only
+ * touch those. The coefficients outside of the range read as zero and can't be written.
+ */
+template <typename Fr> class ActiveRangePolynomial {
+  public:
+    using FF = Fr;
+    using pointer = std::shared_ptr<Fr[]>;
+
+    ActiveRangePolynomial() = default;
+
+    /**
+     * @brief A zero polynomial of the given size, with storage for the coefficients in [start, end).
+     */
+    ActiveRangePolynomial(size_t size, size_t start, size_t end);
+
+    /**
+     * @brief Copy the smallest range holding all of the non-zero coefficients of a dense polynomial.
+     */
+    explicit ActiveRangePolynomial(std::span<const Fr> coefficients);
+
+    /**
+     * @brief The smallest range [start, end) outside of which all of the given coefficients are zero. This is empty,
+     * with start = end = 0, if all of them are.
+     */
+    static std::pair<size_t, size_t> find_active_range(std::span<const Fr> coefficients);
+
+    std::size_t size() const { return size_; }
+    std::size_t start_index() const { return start_; }
+    std::size_t end_index() const { return end_; }
+    std::size_t active_size() const { return end_ - start_; }
+    bool is_active(size_t i) const { return i >= start_ && i < end_; }
+
+    Fr operator[](const size_t i) const { return is_active(i) ? coefficients_.get()[i - start_] : Fr::zero(); }
+
+    Fr& at(const size_t i)
+    {
+        ASSERT(is_active(i));
+        return coefficients_.get()[i - start_];
+    }
+
+    std::span<Fr> active_coefficients() { return { coefficients_.get(), active_size() }; }
+    std::span<const Fr> active_coefficients() const { return { coefficients_.get(), active_size() }; }
+
+    bool operator==(ActiveRangePolynomial const& rhs) const;
+
+    /**
+     * @brief Returns the left-shift of self, which shares its memory.
+     *
+     * @details As for Polynomial::shifted, the coefficient at index 0 must be zero. The active range moves down by one,
+     * so nothing is copied.
+     */
+    ActiveRangePolynomial shifted() const;
+
+    /**
+     * @brief Copy into a dense polynomial of the same size.
+     */
+    Polynomial<Fr> to_dense() const;
+
+    Fr evaluate(const Fr& z) const;
+
+    /**
+     * @brief Evaluate as a multilinear extension, as Polynomial::evaluate_mle does. Each round only folds the active
+     * range, which halves along with the polynomial.
+     */
+    Fr evaluate_mle(std::span<const Fr> evaluation_points, bool shift = false) const;
+
+    /**
+     * @brief Fix the first variable of the multilinear extension to `challenge`, as a round of sumcheck does. The
+     * result has half the size, and an active range covering the halves of this one.
+     */
+    ActiveRangePolynomial partially_evaluate(const Fr& challenge) const;
+
+    /**
+     * @brief The evaluations of the polynomial over the domain, or over its coset for coset_fft.
+     *
+     * @details The result is dense, so these only save the work of the coefficients outside of the active range before
+     * the transform: the copy, and for coset_fft the scaling by powers of the coset generator.
+     */
+    Polynomial<Fr> fft(const EvaluationDomain<Fr>& domain) const
+        requires polynomial_arithmetic::SupportsFFT<Fr>;
+    Polynomial<Fr> coset_fft(const EvaluationDomain<Fr>& domain) const
+        requires polynomial_arithmetic::SupportsFFT<Fr>;
+
+  private:
+    pointer coefficients_;
+    size_t size_ = 0;
+    size_t start_ = 0;
+    size_t end_ = 0;
+};
+
+extern template class ActiveRangePolynomial<barretenberg::fr>;
+extern template class ActiveRangePolynomial<grumpkin::fr>;
+
+} // namespace barretenberg
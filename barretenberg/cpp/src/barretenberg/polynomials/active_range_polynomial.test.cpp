@@ -0,0 +1,106 @@
+#include "active_range_polynomial.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
+#include "polynomial.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace barretenberg;
+
+namespace {
+
+/**
+ * @brief A dense polynomial of the given size, random on [start, end) and zero elsewhere.
+ */
+polynomial random_sparse_polynomial(size_t size, size_t start, size_t end)
+{
+    polynomial result(size);
+    for (size_t i = start; i < end; ++i) {
+        result[i] = fr::random_element();
+    }
+    return result;
+}
+
+} // namespace
+
+TEST(active_range_polynomial, find_active_range)
+{
+    using ActiveRange = ActiveRangePolynomial<fr>;
+    polynomial poly(16);
+    EXPECT_EQ(ActiveRange::find_active_range(poly), std::make_pair(0UL, 0UL));
+    poly[5] = 1;
+    EXPECT_EQ(ActiveRange::find_active_range(poly), std::make_pair(5UL, 6UL));
+    poly[0] = 1;
+    poly[15] = 1;
+    EXPECT_EQ(ActiveRange::find_active_range(poly), std::make_pair(0UL, 16UL));
+}
+
+TEST(active_range_polynomial, matches_dense)
+{
+    constexpr size_t n = 64;
+    for (auto [start, end] : { std::make_pair(0UL, 10UL), std::make_pair(13UL, 38UL), std::make_pair(50UL, 64UL) }) {
+        const polynomial dense = random_sparse_polynomial(n, start, end);
+        const ActiveRangePolynomial<fr> sparse(dense);
+        EXPECT_EQ(sparse.size(), n);
+        EXPECT_EQ(sparse.start_index(), start);
+        EXPECT_EQ(sparse.end_index(), end);
+        EXPECT_EQ(sparse.to_dense(), dense);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(sparse[i], dense[i]);
+        }
+
+        const fr z = fr::random_element();
+        EXPECT_EQ(sparse.evaluate(z), dense.evaluate(z));
+
+        std::vector<fr> u(numeric::get_msb(n));
+        for (auto& u_l : u) {
+            u_l = fr::random_element();
+        }
+        EXPECT_EQ(sparse.evaluate_mle(u), dense.evaluate_mle(u));
+        if (start > 0) {
+            EXPECT_EQ(sparse.evaluate_mle(u, /*shift=*/true), dense.evaluate_mle(u, /*shift=*/true));
+        }
+
+        // A round of sumcheck folding matches folding the dense polynomial.
+        const ActiveRangePolynomial<fr> folded = sparse.partially_evaluate(u[0]);
+        EXPECT_EQ(folded.size(), n / 2);
+        for (size_t i = 0; i < n / 2; ++i) {
+            EXPECT_EQ(folded[i], dense[2 * i] + u[0] * (dense[2 * i + 1] - dense[2 * i]));
+        }
+    }
+}
+
+TEST(active_range_polynomial, shifted)
+{
+    constexpr size_t n = 32;
+    for (size_t start : { 0UL, 7UL }) {
+        // An active range starting at 0 holds the zero coefficient at 0, which the shift drops.
+        ActiveRangePolynomial<fr> sparse(n, start, 20);
+        for (size_t i = std::max(start, 1UL); i < 20; ++i) {
+            sparse.at(i) = fr::random_element();
+        }
+        const ActiveRangePolynomial<fr> shifted = sparse.shifted();
+        // The shift shares the memory of the polynomial.
+        EXPECT_EQ(shifted.active_coefficients().data(), &sparse.active_coefficients()[start == 0 ? 1 : 0]);
+        for (size_t i = 0; i + 1 < n; ++i) {
+            EXPECT_EQ(shifted[i], sparse[i + 1]);
+        }
+    }
+}
+
+TEST(active_range_polynomial, fft)
+{
+    constexpr size_t n = 256;
+    auto domain = evaluation_domain(n);
+    domain.compute_lookup_table();
+
+    const polynomial dense = random_sparse_polynomial(n, 40, 100);
+    const ActiveRangePolynomial<fr> sparse(dense);
+
+    polynomial expected(dense);
+    expected.fft(domain);
+    EXPECT_EQ(sparse.fft(domain), expected);
+
+    polynomial expected_coset(dense);
+    expected_coset.coset_fft(domain);
+    EXPECT_EQ(sparse.coset_fft(domain), expected_coset);
+}
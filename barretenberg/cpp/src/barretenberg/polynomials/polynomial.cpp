@@ -1,5 +1,6 @@
 #include "polynomial.hpp"
 #include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/memory_policy.hpp"
 #include "barretenberg/common/slab_allocator.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/thread_utils.hpp"
@@ -25,7 +26,7 @@ Polynomial<Fr>::Polynomial(const size_t size_)
     if (capacity() > 0) {
         coefficients_ = allocate_aligned_memory(sizeof(Fr) * capacity());
     }
-    memset(static_cast<void*>(coefficients_.get()), 0, sizeof(Fr) * capacity());
+    zero_new_memory(static_cast<void*>(coefficients_.get()), sizeof(Fr) * capacity());
 }
 
 template <typename Fr>
@@ -315,9 +316,8 @@ template <typename Fr> void Polynomial<Fr>::add_scaled(std::span<const Fr> other
     parallel_for(num_threads, [&](size_t j) {
         size_t offset = j * range_per_thread;
         size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            coefficients_.get()[i] += scaling_factor * other[i];
-        }
+        Fr* coeffs = coefficients_.get();
+        Fr::fma_batch(coeffs + offset, &other[offset], scaling_factor, coeffs + offset, end - offset);
     });
 }
 
@@ -332,9 +332,8 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator+=(std::span<cons
     parallel_for(num_threads, [&](size_t j) {
         size_t offset = j * range_per_thread;
         size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            coefficients_.get()[i] += other[i];
-        }
+        Fr* coeffs = coefficients_.get();
+        Fr::add_batch(coeffs + offset, coeffs + offset, &other[offset], end - offset);
     });
 
     return *this;
@@ -351,9 +350,8 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator-=(std::span<cons
     parallel_for(num_threads, [&](size_t j) {
         size_t offset = j * range_per_thread;
         size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            coefficients_.get()[i] -= other[i];
-        }
+        Fr* coeffs = coefficients_.get();
+        Fr::sub_batch(coeffs + offset, coeffs + offset, &other[offset], end - offset);
     });
 
     return *this;
@@ -369,9 +367,8 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator*=(const Fr scali
     parallel_for(num_threads, [&](size_t j) {
         size_t offset = j * range_per_thread;
         size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            coefficients_.get()[i] *= scaling_factor;
-        }
+        Fr* coeffs = coefficients_.get();
+        Fr::scale_batch(coeffs + offset, coeffs + offset, scaling_factor, end - offset);
     });
 
     return *this;
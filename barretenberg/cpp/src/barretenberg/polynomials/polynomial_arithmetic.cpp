@@ -3,8 +3,10 @@
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/slab_allocator.hpp"
 #include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/trace.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "iterate_over_domain.hpp"
+#include <algorithm>
 #include <math.h>
 #include <memory.h>
 #include <memory>
@@ -129,10 +131,7 @@ void scale_by_generator(Fr* coeffs,
         Fr work_generator = generator_start * thread_shift;
         const size_t offset = j * (generator_size / domain.num_threads);
         const size_t end = offset + (generator_size / domain.num_threads);
-        for (size_t i = offset; i < end; ++i) {
-            target[i] = coeffs[i] * work_generator;
-            work_generator *= generator_shift;
-        }
+        Fr::scale_by_powers_batch(target + offset, coeffs + offset, work_generator, generator_shift, end - offset);
     });
 }
 /**
@@ -168,12 +167,357 @@ void compute_multiplicative_subgroup(const size_t log2_subgroup_size,
     }
 }
 
+namespace {
+
+// Domains of at least this size are transformed with the cache-blocked kernel. Smaller ones fit in cache, where the
+// radix-2 kernel's simpler indexing wins.
+constexpr size_t FFT_BLOCKING_THRESHOLD = 1UL << 16;
+// Target number of elements held in a thread's column buffer during the second pass of the blocked kernel.
+constexpr size_t FFT_COLUMN_BUFFER_SIZE = 1UL << 13;
+
+/**
+ * @brief Apply the radix-2 DIT butterfly layers with spans 2^log2_span, ..., 2^(log2_end_span - 1) to `lanes`
+ * interleaved sequences of `size` elements, i.e. sequence k consists of x[k], x[lanes + k], x[2 * lanes + k], ...
+ *
+ * @details Pairs of layers are fused into radix-4 butterflies, so that each element is loaded and stored once per
+ * two layers. Larger radices don't pay for themselves: unlike for complex FFTs, multiplying by a primitive 8th root of
+ * unity costs a full field multiplication. twiddle(l, j, k) returns ω_{2^{l+1}}^j for sequence k.
+ */
+template <typename Fr, typename Twiddle>
+inline void butterfly_layers(
+    Fr* x, const size_t size, const size_t lanes, size_t log2_span, const size_t log2_end_span, const Twiddle& twiddle)
+{
+    Fr temp;
+    for (; log2_span + 1 < log2_end_span; log2_span += 2) {
+        const size_t m = 1UL << log2_span;
+        for (size_t k0 = 0; k0 < size; k0 += 4 * m) {
+            for (size_t j = 0; j < m; ++j) {
+                Fr* x0 = &x[(k0 + j) * lanes];
+                Fr* x1 = x0 + m * lanes;
+                Fr* x2 = x1 + m * lanes;
+                Fr* x3 = x2 + m * lanes;
+                for (size_t k = 0; k < lanes; ++k) {
+                    const Fr& w1 = twiddle(log2_span, j, k);
+                    const Fr& w2 = twiddle(log2_span + 1, j, k);
+                    const Fr& w3 = twiddle(log2_span + 1, j + m, k);
+
+                    temp = w1 * x1[k];
+                    const Fr b0 = x0[k] + temp;
+                    const Fr b1 = x0[k] - temp;
+                    temp = w1 * x3[k];
+                    const Fr b2 = x2[k] + temp;
+                    const Fr b3 = x2[k] - temp;
+
+                    temp = w2 * b2;
+                    x0[k] = b0 + temp;
+                    x2[k] = b0 - temp;
+                    temp = w3 * b3;
+                    x1[k] = b1 + temp;
+                    x3[k] = b1 - temp;
+                }
+            }
+        }
+    }
+    if (log2_span < log2_end_span) {
+        const size_t m = 1UL << log2_span;
+        for (size_t k0 = 0; k0 < size; k0 += 2 * m) {
+            for (size_t j = 0; j < m; ++j) {
+                Fr* x0 = &x[(k0 + j) * lanes];
+                Fr* x1 = x0 + m * lanes;
+                for (size_t k = 0; k < lanes; ++k) {
+                    temp = twiddle(log2_span, j, k) * x1[k];
+                    x1[k] = x0[k] - temp;
+                    x0[k] += temp;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief The shape of the blocked kernels' view of a domain of size n = 2^L as a matrix of n / B rows of B = 2^ceil(L/2)
+ * consecutive elements, and of the batches of columns they process together in their second pass.
+ */
+struct BlockedLayout {
+    size_t log2_row_size;
+    size_t row_size;
+    size_t log2_num_rows;
+    size_t num_rows;
+    size_t batch_size;
+    size_t num_batches;
+
+    template <typename Fr> explicit BlockedLayout(const EvaluationDomain<Fr>& domain)
+        : log2_row_size((domain.log2_size + 1) / 2)
+        , row_size(1UL << log2_row_size)
+        , log2_num_rows(domain.log2_size - log2_row_size)
+        , num_rows(1UL << log2_num_rows)
+    {
+        // Batch at least two columns, as a cache line holds two field elements, but leave a batch for each thread.
+        const size_t max_batch_size = std::max(row_size / domain.num_threads, size_t{ 2 });
+        batch_size = std::clamp(FFT_COLUMN_BUFFER_SIZE / num_rows, size_t{ 2 }, max_batch_size);
+        num_batches = row_size / batch_size;
+    }
+
+    /**
+     * @brief Gather the twiddle factors of the column layers for the batch of columns starting at `column`, laid out as
+     * the batch itself is. The butterfly of span 2^l rows at row offset j of column c uses the twiddle factor of the
+     * global layer at index j * row_size + c, so these are scattered across the round roots.
+     */
+    template <typename Fr>
+    void gather_column_twiddles(Fr* twiddles, const std::vector<Fr*>& root_table, const size_t column) const
+    {
+        for (size_t l = 0; l < log2_num_rows; ++l) {
+            const Fr* round_roots = root_table[l + log2_row_size - 1];
+            for (size_t j = 0; j < (1UL << l); ++j) {
+                for (size_t k = 0; k < batch_size; ++k) {
+                    twiddles[((1UL << l) - 1 + j) * batch_size + k] =
+                        round_roots[(j << log2_row_size) + column + k];
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Apply the column layers to a batch of columns copied into `columns`, given its gathered twiddle factors.
+     */
+    template <typename Fr> void transform_columns(Fr* columns, const Fr* twiddles) const
+    {
+        butterfly_layers(
+            columns, num_rows, batch_size, 0, log2_num_rows, [&](size_t l, size_t j, size_t k) -> const Fr& {
+                return twiddles[((1UL << l) - 1 + j) * batch_size + k];
+            });
+    }
+};
+
+/**
+ * @brief Cache-blocked (four-step) form of the radix-2 FFT computed by fft_inner_parallel.
+ *
+ * @details The radix-2 kernel makes a pass over the whole domain per butterfly layer, which is bound by memory
+ * bandwidth once the domain no longer fits in cache. Here the domain is viewed as a matrix (see BlockedLayout), and the
+ * transform takes two passes over memory:
+ *
+ *  1. Each row is gathered from its bit-reversed input positions into `scratch`, and the first log2(B) layers, whose
+ *     butterflies all lie within a row, are applied while the row is in cache.
+ *  2. The remaining layers combine elements in the same column. Batches of adjacent columns are copied into a
+ *     thread-local buffer, transformed there and written to their output positions.
+ *
+ * The twiddle factors are read from the domain's round roots. Those of the first pass form a table of B elements
+ * which stays in cache, while those of the second pass are gathered per batch of columns.
+ *
+ * @param input Returns the element of the input at a given index.
+ * @param output Returns a reference to the element of the output at a given index. May alias the input.
+ * @param scratch Space for the domain.size intermediate results. May alias the output, but not the input.
+ */
+template <typename Fr, typename Input, typename Output>
+    requires SupportsFFT<Fr>
+void fft_inner_blocked(const Input& input,
+                       const Output& output,
+                       Fr* scratch,
+                       const EvaluationDomain<Fr>& domain,
+                       const std::vector<Fr*>& root_table)
+{
+    const BlockedLayout layout(domain);
+    const size_t log2_size = domain.log2_size;
+
+    parallel_for(domain.num_threads, [&](size_t thread_idx) {
+        const size_t start = (thread_idx * layout.num_rows) / domain.num_threads;
+        const size_t end = ((thread_idx + 1) * layout.num_rows) / domain.num_threads;
+        for (size_t row_idx = start; row_idx < end; ++row_idx) {
+            // Rows are visited in bit-reversed order, as the inputs of rows r and r + num_rows / 2 share cache lines.
+            const size_t row =
+                reverse_bits(static_cast<uint32_t>(row_idx), static_cast<uint32_t>(layout.log2_num_rows));
+            Fr* row_data = &scratch[row * layout.row_size];
+            // The first layer has a twiddle factor of one, so is applied as the row is gathered.
+            for (size_t i = 0; i < layout.row_size; i += 2) {
+                const size_t index = row * layout.row_size + i;
+                const auto swap_index_1 = reverse_bits(static_cast<uint32_t>(index), static_cast<uint32_t>(log2_size));
+                const auto swap_index_2 =
+                    reverse_bits(static_cast<uint32_t>(index + 1), static_cast<uint32_t>(log2_size));
+                const Fr& temp_1 = input(swap_index_1);
+                const Fr& temp_2 = input(swap_index_2);
+                row_data[i + 1] = temp_1 - temp_2;
+                row_data[i] = temp_1 + temp_2;
+            }
+            butterfly_layers(
+                row_data, layout.row_size, 1, 1, layout.log2_row_size, [&](size_t l, size_t j, size_t) -> const Fr& {
+                    return root_table[l - 1][j];
+                });
+        }
+    });
+
+    parallel_for(domain.num_threads, [&](size_t thread_idx) {
+        const size_t start = (thread_idx * layout.num_batches) / domain.num_threads;
+        const size_t end = ((thread_idx + 1) * layout.num_batches) / domain.num_threads;
+        std::vector<Fr> columns(layout.num_rows * layout.batch_size);
+        std::vector<Fr> twiddles(layout.num_rows * layout.batch_size);
+        for (size_t batch = start; batch < end; ++batch) {
+            const size_t column = batch * layout.batch_size;
+            for (size_t row = 0; row < layout.num_rows; ++row) {
+                for (size_t k = 0; k < layout.batch_size; ++k) {
+                    columns[row * layout.batch_size + k] = scratch[row * layout.row_size + column + k];
+                }
+            }
+            layout.gather_column_twiddles(twiddles.data(), root_table, column);
+            layout.transform_columns(columns.data(), twiddles.data());
+            for (size_t row = 0; row < layout.num_rows; ++row) {
+                for (size_t k = 0; k < layout.batch_size; ++k) {
+                    output(row * layout.row_size + column + k) = columns[row * layout.batch_size + k];
+                }
+            }
+        }
+    });
+}
+
+/**
+ * @brief Transform several polynomials of the domain's size in place, each as fft_inner_blocked would.
+ *
+ * @details Transforming the polynomials one after the other would reload the twiddle factors and pay for the parallel
+ * jobs of each. Here each pass is a single parallel job over all of the polynomials:
+ *
+ *  1. Each polynomial is permuted into bit-reversed order in place, as scratch space for the gather of
+ *     fft_inner_blocked would be needed per polynomial.
+ *  2. The same row of several polynomials is copied into an interleaved tile, so that each twiddle factor of the row
+ *     layers is loaded once for all of them.
+ *  3. The twiddle factors of each batch of columns are gathered once, then used for that batch of every polynomial.
+ *
+ * @param output_scale If not null, each output is multiplied by it as it is written.
+ */
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_inner_batch(const std::vector<Fr*>& polys,
+                     const EvaluationDomain<Fr>& domain,
+                     const std::vector<Fr*>& root_table,
+                     const Fr* output_scale)
+{
+    if (polys.empty() || domain.size < 4) {
+        for (Fr* poly : polys) {
+            fft_inner_parallel({ poly }, domain, domain.root, root_table);
+            for (size_t i = 0; output_scale != nullptr && i < domain.size; ++i) {
+                poly[i] *= *output_scale;
+            }
+        }
+        return;
+    }
+
+    const BlockedLayout layout(domain);
+    const size_t log2_size = domain.log2_size;
+    const size_t tile_width = std::clamp(FFT_COLUMN_BUFFER_SIZE / layout.row_size, size_t{ 1 }, polys.size());
+
+    parallel_for(domain.num_threads, [&](size_t thread_idx) {
+        const size_t start = (thread_idx * domain.size) / domain.num_threads;
+        const size_t end = ((thread_idx + 1) * domain.size) / domain.num_threads;
+        for (Fr* poly : polys) {
+            for (size_t i = start; i < end; ++i) {
+                const size_t swap_index = reverse_bits(static_cast<uint32_t>(i), static_cast<uint32_t>(log2_size));
+                if (i < swap_index) {
+                    Fr::__swap(poly[i], poly[swap_index]);
+                }
+            }
+        }
+    });
+
+    parallel_for(domain.num_threads, [&](size_t thread_idx) {
+        const size_t start = (thread_idx * layout.num_rows) / domain.num_threads;
+        const size_t end = ((thread_idx + 1) * layout.num_rows) / domain.num_threads;
+        std::vector<Fr> tile(layout.row_size * tile_width);
+        for (size_t row = start; row < end; ++row) {
+            for (size_t first_poly = 0; first_poly < polys.size(); first_poly += tile_width) {
+                const size_t width = std::min(tile_width, polys.size() - first_poly);
+                // The first layer has a twiddle factor of one, so is applied as the tile is filled.
+                for (size_t k = 0; k < width; ++k) {
+                    const Fr* row_data = &polys[first_poly + k][row * layout.row_size];
+                    for (size_t i = 0; i < layout.row_size; i += 2) {
+                        tile[i * width + k] = row_data[i] + row_data[i + 1];
+                        tile[(i + 1) * width + k] = row_data[i] - row_data[i + 1];
+                    }
+                }
+                butterfly_layers(tile.data(),
+                                 layout.row_size,
+                                 width,
+                                 1,
+                                 layout.log2_row_size,
+                                 [&](size_t l, size_t j, size_t) -> const Fr& { return root_table[l - 1][j]; });
+                for (size_t k = 0; k < width; ++k) {
+                    Fr* row_data = &polys[first_poly + k][row * layout.row_size];
+                    for (size_t i = 0; i < layout.row_size; ++i) {
+                        row_data[i] = tile[i * width + k];
+                    }
+                }
+            }
+        }
+    });
+
+    parallel_for(domain.num_threads, [&](size_t thread_idx) {
+        const size_t start = (thread_idx * layout.num_batches) / domain.num_threads;
+        const size_t end = ((thread_idx + 1) * layout.num_batches) / domain.num_threads;
+        std::vector<Fr> columns(layout.num_rows * layout.batch_size);
+        std::vector<Fr> twiddles(layout.num_rows * layout.batch_size);
+        for (size_t batch = start; batch < end; ++batch) {
+            const size_t column = batch * layout.batch_size;
+            layout.gather_column_twiddles(twiddles.data(), root_table, column);
+            for (Fr* poly : polys) {
+                for (size_t row = 0; row < layout.num_rows; ++row) {
+                    for (size_t k = 0; k < layout.batch_size; ++k) {
+                        columns[row * layout.batch_size + k] = poly[row * layout.row_size + column + k];
+                    }
+                }
+                layout.transform_columns(columns.data(), twiddles.data());
+                for (size_t row = 0; row < layout.num_rows; ++row) {
+                    for (size_t k = 0; k < layout.batch_size; ++k) {
+                        Fr& result = poly[row * layout.row_size + column + k];
+                        result = columns[row * layout.batch_size + k];
+                        if (output_scale != nullptr) {
+                            result *= *output_scale;
+                        }
+                    }
+                }
+            }
+        }
+    });
+}
+
+} // namespace
+
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_inner_parallel_blocked(std::vector<Fr*> coeffs,
+                                const EvaluationDomain<Fr>& domain,
+                                const std::vector<Fr*>& root_table)
+{
+    auto scratch_space_ptr = get_scratch_space<Fr>(domain.size);
+
+    const size_t num_polys = coeffs.size();
+    ASSERT(is_power_of_two(num_polys));
+    const size_t poly_size = domain.size / num_polys;
+    ASSERT(is_power_of_two(poly_size));
+    const size_t poly_mask = poly_size - 1;
+    const size_t log2_poly_size = (size_t)numeric::get_msb(poly_size);
+
+    auto element = [&](size_t index) -> Fr& { return coeffs[index >> log2_poly_size][index & poly_mask]; };
+    fft_inner_blocked(element, element, scratch_space_ptr.get(), domain, root_table);
+}
+
 template <typename Fr>
     requires SupportsFFT<Fr>
 void fft_inner_parallel(std::vector<Fr*> coeffs,
                         const EvaluationDomain<Fr>& domain,
-                        const Fr&,
+                        const Fr& root,
                         const std::vector<Fr*>& root_table)
+{
+    BB_TRACE_SCOPE_COUNTS("fft_inner_parallel", domain.size, domain.size * sizeof(Fr));
+    if (domain.size >= FFT_BLOCKING_THRESHOLD) {
+        fft_inner_parallel_blocked(coeffs, domain, root_table);
+    } else {
+        fft_inner_parallel_radix_2(coeffs, domain, root, root_table);
+    }
+}
+
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_inner_parallel_radix_2(std::vector<Fr*> coeffs,
+                                const EvaluationDomain<Fr>& domain,
+                                const Fr&,
+                                const std::vector<Fr*>& root_table)
 {
     auto scratch_space_ptr = get_scratch_space<Fr>(domain.size);
     auto scratch_space = scratch_space_ptr.get();
@@ -301,6 +645,15 @@ template <typename Fr>
 void fft_inner_parallel(
     Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain, const Fr&, const std::vector<Fr*>& root_table)
 {
+    BB_TRACE_SCOPE_COUNTS("fft_inner_parallel", domain.size, 2 * domain.size * sizeof(Fr));
+    if (domain.size >= FFT_BLOCKING_THRESHOLD) {
+        fft_inner_blocked([&](size_t index) -> const Fr& { return coeffs[index]; },
+                          [&](size_t index) -> Fr& { return target[index]; },
+                          target,
+                          domain,
+                          root_table);
+        return;
+    }
     parallel_for(domain.num_threads, [&](size_t j) {
         Fr temp_1;
         Fr temp_2;
@@ -737,6 +1090,42 @@ void coset_ifft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain)
     }
 }
 
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_batch(const std::vector<Fr*>& coeffs, const EvaluationDomain<Fr>& domain)
+{
+    BB_TRACE_SCOPE_COUNTS("fft_batch", coeffs.size() * domain.size, coeffs.size() * domain.size * sizeof(Fr));
+    fft_inner_batch<Fr>(coeffs, domain, domain.get_round_roots(), nullptr);
+}
+
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void ifft_batch(const std::vector<Fr*>& coeffs, const EvaluationDomain<Fr>& domain)
+{
+    BB_TRACE_SCOPE_COUNTS("ifft_batch", coeffs.size() * domain.size, coeffs.size() * domain.size * sizeof(Fr));
+    fft_inner_batch(coeffs, domain, domain.get_inverse_round_roots(), &domain.domain_inverse);
+}
+
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void coset_fft_batch(const std::vector<Fr*>& coeffs, const EvaluationDomain<Fr>& domain)
+{
+    BB_TRACE_SCOPE_COUNTS("coset_fft_batch", coeffs.size() * domain.size, coeffs.size() * domain.size * sizeof(Fr));
+    parallel_for(domain.num_threads, [&](size_t j) {
+        const size_t start = (j * domain.generator_size) / domain.num_threads;
+        const size_t end = ((j + 1) * domain.generator_size) / domain.num_threads;
+        const Fr generator_start = domain.generator.pow(static_cast<uint64_t>(start));
+        for (Fr* poly : coeffs) {
+            Fr work_generator = generator_start;
+            for (size_t i = start; i < end; ++i) {
+                poly[i] *= work_generator;
+                work_generator *= domain.generator;
+            }
+        }
+    });
+    fft_inner_batch<Fr>(coeffs, domain, domain.get_round_roots(), nullptr);
+}
+
 template <typename Fr>
 void add(const Fr* a_coeffs, const Fr* b_coeffs, Fr* r_coeffs, const EvaluationDomain<Fr>& domain)
 {
@@ -1371,6 +1760,11 @@ template fr evaluate<fr>(const std::vector<fr*>, const fr&, const size_t);
 template void copy_polynomial<fr>(const fr*, fr*, size_t, size_t);
 template void fft_inner_serial<fr>(std::vector<fr*>, const size_t, const std::vector<fr*>&);
 template void fft_inner_parallel<fr>(std::vector<fr*>, const EvaluationDomain<fr>&, const fr&, const std::vector<fr*>&);
+template void fft_inner_parallel_radix_2<fr>(std::vector<fr*>,
+                                            const EvaluationDomain<fr>&,
+                                            const fr&,
+                                            const std::vector<fr*>&);
+template void fft_inner_parallel_blocked<fr>(std::vector<fr*>, const EvaluationDomain<fr>&, const std::vector<fr*>&);
 template void fft<fr>(fr*, const EvaluationDomain<fr>&);
 template void fft<fr>(fr*, fr*, const EvaluationDomain<fr>&);
 template void fft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
@@ -1387,6 +1781,9 @@ template void ifft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
 template void ifft_with_constant<fr>(fr*, const EvaluationDomain<fr>&, const fr&);
 template void coset_ifft<fr>(fr*, const EvaluationDomain<fr>&);
 template void coset_ifft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
+template void fft_batch<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
+template void ifft_batch<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
+template void coset_fft_batch<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
 template void partial_fft_serial_inner<fr>(fr*, fr*, const EvaluationDomain<fr>&, const std::vector<fr*>&);
 template void partial_fft_parellel_inner<fr>(fr*, const EvaluationDomain<fr>&, const std::vector<fr*>&, fr, bool);
 template void partial_fft_serial<fr>(fr*, fr*, const EvaluationDomain<fr>&);
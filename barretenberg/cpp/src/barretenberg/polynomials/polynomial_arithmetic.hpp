@@ -38,6 +38,19 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
                         const EvaluationDomain<Fr>& domain,
                         const Fr&,
                         const std::vector<Fr*>& root_table);
+// The kernels fft_inner_parallel chooses between: a radix-2 FFT making a pass over memory per layer, for domains which
+// fit in cache, and a cache-blocked FFT making two passes over memory, for larger domains.
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_inner_parallel_radix_2(std::vector<Fr*> coeffs,
+                                const EvaluationDomain<Fr>& domain,
+                                const Fr&,
+                                const std::vector<Fr*>& root_table);
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_inner_parallel_blocked(std::vector<Fr*> coeffs,
+                                const EvaluationDomain<Fr>& domain,
+                                const std::vector<Fr*>& root_table);
 
 template <typename Fr>
     requires SupportsFFT<Fr>
@@ -96,6 +109,19 @@ template <typename Fr>
     requires SupportsFFT<Fr>
 void coset_ifft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain);
 
+// Transform each of several polynomials of the domain's size in place. Equivalent to calling fft, ifft or coset_fft on
+// each in turn, but the polynomials share each load of the twiddle factors and each parallel job, so this is faster for
+// more than a couple of polynomials.
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_batch(const std::vector<Fr*>& coeffs, const EvaluationDomain<Fr>& domain);
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void ifft_batch(const std::vector<Fr*>& coeffs, const EvaluationDomain<Fr>& domain);
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void coset_fft_batch(const std::vector<Fr*>& coeffs, const EvaluationDomain<Fr>& domain);
+
 template <typename Fr>
     requires SupportsFFT<Fr>
 void partial_fft_serial_inner(Fr* coeffs,
@@ -384,6 +410,13 @@ extern template void fft_inner_parallel<fr>(std::vector<fr*>,
                                             const EvaluationDomain<fr>&,
                                             const fr&,
                                             const std::vector<fr*>&);
+extern template void fft_inner_parallel_radix_2<fr>(std::vector<fr*>,
+                                                    const EvaluationDomain<fr>&,
+                                                    const fr&,
+                                                    const std::vector<fr*>&);
+extern template void fft_inner_parallel_blocked<fr>(std::vector<fr*>,
+                                                    const EvaluationDomain<fr>&,
+                                                    const std::vector<fr*>&);
 extern template void fft<fr>(fr*, const EvaluationDomain<fr>&);
 extern template void fft<fr>(fr*, fr*, const EvaluationDomain<fr>&);
 extern template void fft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
@@ -400,6 +433,9 @@ extern template void ifft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
 extern template void ifft_with_constant<fr>(fr*, const EvaluationDomain<fr>&, const fr&);
 extern template void coset_ifft<fr>(fr*, const EvaluationDomain<fr>&);
 extern template void coset_ifft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
+extern template void fft_batch<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
+extern template void ifft_batch<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
+extern template void coset_fft_batch<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
 extern template void partial_fft_serial_inner<fr>(fr*, fr*, const EvaluationDomain<fr>&, const std::vector<fr*>&);
 extern template void partial_fft_parellel_inner<fr>(
     fr*, const EvaluationDomain<fr>&, const std::vector<fr*>&, fr, bool);
@@ -1,10 +1,13 @@
 #include "polynomial_arithmetic.hpp"
 #include "barretenberg/common/mem.hpp"
+#include "barretenberg/common/memory_policy.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
 #include "barretenberg/polynomials/evaluation_domain.hpp"
 #include "polynomial.hpp"
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <gtest/gtest.h>
 #include <utility>
@@ -136,6 +139,95 @@ TEST(polynomials, basic_fft)
     aligned_free(data);
 }
 
+/**
+ * @brief Check the cache-blocked FFT kernel against the radix-2 one, for an even and an odd number of layers and for
+ * polynomials split across several arrays, as well as through the out-of-place and coset entry points.
+ */
+TEST(polynomials, blocked_fft_matches_radix_2)
+{
+    for (size_t log2_n : { 16UL, 17UL }) {
+        const size_t n = 1UL << log2_n;
+        auto domain = evaluation_domain(n);
+        domain.compute_lookup_table();
+
+        polynomial poly(n);
+        for (size_t i = 0; i < n; ++i) {
+            poly[i] = fr::random_element();
+        }
+        polynomial expected(poly);
+        polynomial_arithmetic::fft_inner_parallel_radix_2(
+            { expected.data().get() }, domain, domain.root, domain.get_round_roots());
+
+        constexpr size_t num_polys = 4;
+        std::vector<polynomial> split(num_polys, polynomial(n / num_polys));
+        std::vector<fr*> split_coeffs;
+        for (size_t j = 0; j < num_polys; ++j) {
+            std::copy_n(&poly[j * (n / num_polys)], n / num_polys, &split[j][0]);
+            split_coeffs.push_back(split[j].data().get());
+        }
+        polynomial_arithmetic::fft_inner_parallel_blocked(split_coeffs, domain, domain.get_round_roots());
+
+        polynomial result(n);
+        polynomial_arithmetic::fft(poly.data().get(), result.data().get(), domain);
+
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(split[i / (n / num_polys)][i % (n / num_polys)], expected[i]);
+            EXPECT_EQ(result[i], expected[i]);
+        }
+
+        polynomial coset(poly);
+        polynomial_arithmetic::coset_fft(coset.data().get(), domain);
+        polynomial_arithmetic::coset_ifft(coset.data().get(), domain);
+        EXPECT_EQ(coset, poly);
+    }
+}
+
+/**
+ * @brief Check the batched transforms against transforming each polynomial in turn, on both sides of the blocking
+ * threshold.
+ */
+TEST(polynomials, batched_ffts_match_unbatched)
+{
+    constexpr size_t num_polys = 5;
+    for (size_t log2_n : { 2UL, 8UL, 16UL }) {
+        const size_t n = 1UL << log2_n;
+        auto domain = evaluation_domain(n);
+        domain.compute_lookup_table();
+
+        std::vector<polynomial> polys;
+        for (size_t j = 0; j < num_polys; ++j) {
+            polys.emplace_back(n);
+            for (size_t i = 0; i < n; ++i) {
+                polys[j][i] = fr::random_element();
+            }
+        }
+        std::vector<polynomial> batched(polys);
+        std::vector<fr*> batched_coeffs;
+        for (auto& poly : batched) {
+            batched_coeffs.push_back(poly.data().get());
+        }
+
+        polynomial_arithmetic::fft_batch(batched_coeffs, domain);
+        for (size_t j = 0; j < num_polys; ++j) {
+            polynomial expected(polys[j]);
+            polynomial_arithmetic::fft(expected.data().get(), domain);
+            EXPECT_EQ(batched[j], expected);
+        }
+
+        polynomial_arithmetic::ifft_batch(batched_coeffs, domain);
+        for (size_t j = 0; j < num_polys; ++j) {
+            EXPECT_EQ(batched[j], polys[j]);
+        }
+
+        polynomial_arithmetic::coset_fft_batch(batched_coeffs, domain);
+        for (size_t j = 0; j < num_polys; ++j) {
+            polynomial expected(polys[j]);
+            polynomial_arithmetic::coset_fft(expected.data().get(), domain);
+            EXPECT_EQ(batched[j], expected);
+        }
+    }
+}
+
 TEST(polynomials, fft_ifft_consistency)
 {
     constexpr size_t n = 256;
@@ -1268,3 +1360,33 @@ TYPED_TEST(PolynomialTests, RightShift)
 
     EXPECT_EQ(shifted_evaluation, shifted_eval_reconstructed);
 }
+
+/**
+ * @brief Polynomials are zero however their pages are placed, including when allocated within a parallel_for.
+ */
+TEST(polynomials, memory_policies_zero_new_polynomials)
+{
+    // Large enough to be zeroed in parallel.
+    constexpr size_t n = 1UL << 16;
+    const MemoryPolicy original_policy = get_memory_policy();
+    for (auto policy : { MemoryPolicy::SERIAL, MemoryPolicy::FIRST_TOUCH, MemoryPolicy::INTERLEAVE }) {
+        set_memory_policy(policy);
+        // Dirty memory which the allocator may hand back for the polynomials below.
+        {
+            polynomial dirty(n);
+            for (auto& coeff : dirty) {
+                coeff = fr::random_element();
+            }
+        }
+        polynomial poly(n);
+        EXPECT_TRUE(std::all_of(poly.begin(), poly.end(), [](const fr& coeff) { return coeff.is_zero(); }));
+
+        std::array<bool, 4> all_zero{};
+        parallel_for(all_zero.size(), [&](size_t i) {
+            polynomial nested(n);
+            all_zero[i] = std::all_of(nested.begin(), nested.end(), [](const fr& coeff) { return coeff.is_zero(); });
+        });
+        EXPECT_TRUE(std::all_of(all_zero.begin(), all_zero.end(), [](bool zero) { return zero; }));
+    }
+    set_memory_policy(original_policy);
+}
@@ -7,6 +7,7 @@
 #include "barretenberg/ecc/groups/wnaf.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 #include "barretenberg/srs/io.hpp"
 #include <benchmark/benchmark.h>
@@ -241,6 +242,78 @@ void fft_bench_parallel(State& state) noexcept
 }
 BENCHMARK(fft_bench_parallel)->RangeMultiplier(2)->Range(START * 4, MAX_GATES * 4)->Unit(benchmark::kMicrosecond);
 
+// The two kernels fft_bench_parallel dispatches between, on either side of the blocking threshold.
+void fft_radix_2_bench(State& state) noexcept
+{
+    for (auto _ : state) {
+        size_t idx = (size_t)numeric::get_msb((uint64_t)state.range(0)) - (size_t)numeric::get_msb(START);
+        const auto& domain = evaluation_domains[idx];
+        barretenberg::polynomial_arithmetic::fft_inner_parallel_radix_2(
+            { globals.data }, domain, domain.root, domain.get_round_roots());
+    }
+}
+BENCHMARK(fft_radix_2_bench)->RangeMultiplier(2)->Range(START * 4, MAX_GATES * 4)->Unit(benchmark::kMicrosecond);
+
+void fft_blocked_bench(State& state) noexcept
+{
+    for (auto _ : state) {
+        size_t idx = (size_t)numeric::get_msb((uint64_t)state.range(0)) - (size_t)numeric::get_msb(START);
+        const auto& domain = evaluation_domains[idx];
+        barretenberg::polynomial_arithmetic::fft_inner_parallel_blocked(
+            { globals.data }, domain, domain.get_round_roots());
+    }
+}
+BENCHMARK(fft_blocked_bench)->RangeMultiplier(2)->Range(START * 4, MAX_GATES * 4)->Unit(benchmark::kMicrosecond);
+
+// Coset FFTs of the 11 selectors of an UltraPlonk key, one after the other and batched.
+constexpr size_t NUM_ULTRA_SELECTORS = 11;
+
+std::vector<polynomial> random_selectors(const size_t size)
+{
+    std::vector<polynomial> selectors;
+    for (size_t j = 0; j < NUM_ULTRA_SELECTORS; ++j) {
+        selectors.emplace_back(size);
+        for (size_t i = 0; i < size; ++i) {
+            selectors[j][i] = fr::random_element();
+        }
+    }
+    return selectors;
+}
+
+void coset_fft_selectors_sequential_bench(State& state) noexcept
+{
+    size_t idx = (size_t)numeric::get_msb((uint64_t)state.range(0)) - (size_t)numeric::get_msb(START);
+    const auto& domain = evaluation_domains[idx];
+    auto selectors = random_selectors(domain.size);
+    for (auto _ : state) {
+        for (auto& selector : selectors) {
+            barretenberg::polynomial_arithmetic::coset_fft(selector.data().get(), domain);
+        }
+    }
+}
+BENCHMARK(coset_fft_selectors_sequential_bench)
+    ->RangeMultiplier(2)
+    ->Range(START * 4, MAX_GATES)
+    ->Unit(benchmark::kMillisecond);
+
+void coset_fft_selectors_batched_bench(State& state) noexcept
+{
+    size_t idx = (size_t)numeric::get_msb((uint64_t)state.range(0)) - (size_t)numeric::get_msb(START);
+    const auto& domain = evaluation_domains[idx];
+    auto selectors = random_selectors(domain.size);
+    std::vector<fr*> coeffs;
+    for (auto& selector : selectors) {
+        coeffs.push_back(selector.data().get());
+    }
+    for (auto _ : state) {
+        barretenberg::polynomial_arithmetic::coset_fft_batch(coeffs, domain);
+    }
+}
+BENCHMARK(coset_fft_selectors_batched_bench)
+    ->RangeMultiplier(2)
+    ->Range(START * 4, MAX_GATES)
+    ->Unit(benchmark::kMillisecond);
+
 void fft_bench_serial(State& state) noexcept
 {
     for (auto _ : state) {
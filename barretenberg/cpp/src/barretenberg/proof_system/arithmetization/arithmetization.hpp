@@ -1,7 +1,7 @@
 #pragma once
+#include "barretenberg/common/block_vector.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include <array>
-#include <barretenberg/common/slab_allocator.hpp>
 #include <cstddef>
 #include <vector>
 
@@ -38,7 +38,7 @@ template <size_t _NUM_WIRES, size_t _num_selectors> struct Arithmetization {
 };
 
 template <typename FF, size_t num_selectors> struct SelectorsBase {
-    using DataType = std::array<std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>, num_selectors>;
+    using DataType = std::array<barretenberg::BlockVector<FF>, num_selectors>;
     DataType _data;
     size_t size() { return _data.size(); };
     typename DataType::const_iterator begin() const { return _data.begin(); };
@@ -53,11 +53,11 @@ template <typename _FF> class Standard : public Arithmetization</*NUM_WIRES =*/3
   public:
     using FF = _FF;
     struct Selectors : SelectorsBase<FF, num_selectors> {
-        std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>& q_m = std::get<0>(this->_data);
-        std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>& q_1 = std::get<1>(this->_data);
-        std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>& q_2 = std::get<2>(this->_data);
-        std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>& q_3 = std::get<3>(this->_data);
-        std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>& q_c = std::get<4>(this->_data);
+        barretenberg::BlockVector<FF>& q_m = std::get<0>(this->_data);
+        barretenberg::BlockVector<FF>& q_1 = std::get<1>(this->_data);
+        barretenberg::BlockVector<FF>& q_2 = std::get<2>(this->_data);
+        barretenberg::BlockVector<FF>& q_3 = std::get<3>(this->_data);
+        barretenberg::BlockVector<FF>& q_c = std::get<4>(this->_data);
         Selectors()
             : SelectorsBase<FF, num_selectors>(){};
         Selectors(const Selectors& other)
@@ -85,17 +85,17 @@ template <typename _FF> class Turbo : public Arithmetization</*NUM_WIRES =*/4, /
   public:
     using FF = _FF;
     struct Selectors : SelectorsBase<FF, num_selectors> {
-        std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>& q_m = std::get<0>(this->_data);
-        std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>& q_c = std::get<1>(this->_data);
-        std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>& q_1 = std::get<2>(this->_data);
-        std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>& q_2 = std::get<3>(this->_data);
-        std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>& q_3 = std::get<4>(this->_data);
-        std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>& q_4 = std::get<5>(this->_data);
-        std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>& q_5 = std::get<6>(this->_data);
-        std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>& q_arith = std::get<7>(this->_data);
-        std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>& q_fixed_base = std::get<8>(this->_data);
-        std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>& q_range = std::get<9>(this->_data);
-        std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>& q_logic = std::get<10>(this->_data);
+        barretenberg::BlockVector<FF>& q_m = std::get<0>(this->_data);
+        barretenberg::BlockVector<FF>& q_c = std::get<1>(this->_data);
+        barretenberg::BlockVector<FF>& q_1 = std::get<2>(this->_data);
+        barretenberg::BlockVector<FF>& q_2 = std::get<3>(this->_data);
+        barretenberg::BlockVector<FF>& q_3 = std::get<4>(this->_data);
+        barretenberg::BlockVector<FF>& q_4 = std::get<5>(this->_data);
+        barretenberg::BlockVector<FF>& q_5 = std::get<6>(this->_data);
+        barretenberg::BlockVector<FF>& q_arith = std::get<7>(this->_data);
+        barretenberg::BlockVector<FF>& q_fixed_base = std::get<8>(this->_data);
+        barretenberg::BlockVector<FF>& q_range = std::get<9>(this->_data);
+        barretenberg::BlockVector<FF>& q_logic = std::get<10>(this->_data);
         Selectors()
             : SelectorsBase<FF, num_selectors>(){};
         Selectors(const Selectors& other)
@@ -129,17 +129,17 @@ template <typename _FF> class Ultra : public Arithmetization</*NUM_WIRES =*/4, /
   public:
     using FF = _FF;
     struct Selectors : SelectorsBase<FF, num_selectors> {
-        std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>& q_m = std::get<0>(this->_data);
-        std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>& q_c = std::get<1>(this->_data);
-        std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>& q_1 = std::get<2>(this->_data);
-        std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>& q_2 = std::get<3>(this->_data);
-        std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>& q_3 = std::get<4>(this->_data);
-        std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>& q_4 = std::get<5>(this->_data);
-        std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>& q_arith = std::get<6>(this->_data);
-        std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>& q_sort = std::get<7>(this->_data);
-        std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>& q_elliptic = std::get<8>(this->_data);
-        std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>& q_aux = std::get<9>(this->_data);
-        std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>& q_lookup_type = std::get<10>(this->_data);
+        barretenberg::BlockVector<FF>& q_m = std::get<0>(this->_data);
+        barretenberg::BlockVector<FF>& q_c = std::get<1>(this->_data);
+        barretenberg::BlockVector<FF>& q_1 = std::get<2>(this->_data);
+        barretenberg::BlockVector<FF>& q_2 = std::get<3>(this->_data);
+        barretenberg::BlockVector<FF>& q_3 = std::get<4>(this->_data);
+        barretenberg::BlockVector<FF>& q_4 = std::get<5>(this->_data);
+        barretenberg::BlockVector<FF>& q_arith = std::get<6>(this->_data);
+        barretenberg::BlockVector<FF>& q_sort = std::get<7>(this->_data);
+        barretenberg::BlockVector<FF>& q_elliptic = std::get<8>(this->_data);
+        barretenberg::BlockVector<FF>& q_aux = std::get<9>(this->_data);
+        barretenberg::BlockVector<FF>& q_lookup_type = std::get<10>(this->_data);
         Selectors()
             : SelectorsBase<FF, num_selectors>(){};
         Selectors(const Selectors& other)
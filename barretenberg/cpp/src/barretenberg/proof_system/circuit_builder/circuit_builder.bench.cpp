@@ -0,0 +1,193 @@
+#include "barretenberg/proof_system/circuit_builder/standard_circuit_builder.hpp"
+#include "barretenberg/proof_system/circuit_builder/ultra_circuit_builder.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+using namespace barretenberg;
+
+namespace {
+
+using Builder = proof_system::UltraCircuitBuilder;
+
+/**
+ * @brief Equate many fresh variables with one ever-growing class, as happens to constants, accumulators and the outputs
+ * of recursive verifiers. The fresh variable is passed first or second depending on the argument: each order stressed
+ * a different linear walk of the class when classes were linked lists.
+ */
+void assert_equal_long_chain(State& state) noexcept
+{
+    const auto num_variables = static_cast<size_t>(state.range(0));
+    const bool fresh_variable_first = state.range(1) != 0;
+    for (auto _ : state) {
+        Builder builder;
+        const uint32_t accumulator = builder.add_variable(fr(42));
+        for (size_t i = 0; i < num_variables; ++i) {
+            const uint32_t variable = builder.add_variable(fr(42));
+            if (fresh_variable_first) {
+                builder.assert_equal(variable, accumulator);
+            } else {
+                builder.assert_equal(accumulator, variable);
+            }
+        }
+        DoNotOptimize(builder.get_variable(accumulator));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(assert_equal_long_chain)
+    ->ArgsProduct({ { 1 << 10, 1 << 14, 1 << 17 }, { 0, 1 } })
+    ->Unit(kMillisecond);
+
+/**
+ * @brief Merge pairs of classes of equal size, then pairs of the merged classes, and so on, so that every merge joins
+ * two large classes.
+ */
+void assert_equal_balanced_merges(State& state) noexcept
+{
+    const auto num_variables = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        Builder builder;
+        std::vector<uint32_t> variables(num_variables);
+        for (auto& variable : variables) {
+            variable = builder.add_variable(fr(7));
+        }
+        for (size_t stride = 1; stride < num_variables; stride *= 2) {
+            for (size_t i = 0; i + stride < num_variables; i += 2 * stride) {
+                builder.assert_equal(variables[i], variables[i + stride]);
+            }
+        }
+        DoNotOptimize(builder.get_real_variable_indices());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(assert_equal_balanced_merges)->RangeMultiplier(8)->Range(1 << 11, 1 << 17)->Unit(kMillisecond);
+
+/**
+ * @brief Look up the values of variables in a large class, as circuit construction does between copy constraints.
+ */
+void get_variable_in_long_chain(State& state) noexcept
+{
+    const auto num_variables = static_cast<size_t>(state.range(0));
+    Builder builder;
+    const uint32_t accumulator = builder.add_variable(fr(42));
+    std::vector<uint32_t> variables(num_variables);
+    for (auto& variable : variables) {
+        variable = builder.add_variable(fr(42));
+        builder.assert_equal(accumulator, variable);
+    }
+    for (auto _ : state) {
+        fr sum = 0;
+        for (const auto& variable : variables) {
+            sum += builder.get_variable(variable);
+        }
+        DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(get_variable_in_long_chain)->RangeMultiplier(8)->Range(1 << 11, 1 << 17);
+
+/**
+ * @brief Finalize a circuit of many range-constrained limbs, as bigfield and the uint gadgets produce, in a few range
+ * lists. Finalizing sorts each list and adds its sort constraint.
+ */
+void process_range_lists(State& state) noexcept
+{
+    const auto num_limbs = static_cast<size_t>(state.range(0));
+    const std::vector<uint64_t> ranges{ (1 << 14) - 1, (1 << 12) - 1, (1 << 8) - 1, 3 };
+    for (auto _ : state) {
+        state.PauseTiming();
+        Builder builder;
+        auto& engine = numeric::random::get_debug_engine(true);
+        for (size_t i = 0; i < num_limbs; ++i) {
+            const uint64_t range = ranges[i % ranges.size()];
+            builder.create_new_range_constraint(builder.add_variable(engine.get_random_uint64() % (range + 1)), range);
+        }
+        state.ResumeTiming();
+        builder.finalize_circuit();
+        DoNotOptimize(builder.num_gates);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(process_range_lists)->RangeMultiplier(8)->Range(1 << 14, 1 << 20)->Unit(kMillisecond);
+
+/**
+ * @brief Finalize a circuit with many small ROM and RAM arrays, as ACIR programs with many block constraints produce.
+ * Finalizing sorts each array's accesses and adds the gates that check them.
+ */
+void process_memory_arrays(State& state) noexcept
+{
+    const auto num_arrays = static_cast<size_t>(state.range(0));
+    constexpr size_t ARRAY_SIZE = 64;
+    constexpr size_t NUM_ACCESSES = 256;
+    for (auto _ : state) {
+        state.PauseTiming();
+        Builder builder;
+        auto& engine = numeric::random::get_debug_engine(true);
+        for (size_t i = 0; i < num_arrays; ++i) {
+            const size_t rom_id = builder.create_ROM_array(ARRAY_SIZE);
+            const size_t ram_id = builder.create_RAM_array(ARRAY_SIZE);
+            for (size_t j = 0; j < ARRAY_SIZE; ++j) {
+                builder.set_ROM_element(rom_id, j, builder.add_variable(fr(j)));
+                builder.init_RAM_element(ram_id, j, builder.add_variable(fr(j)));
+            }
+            for (size_t j = 0; j < NUM_ACCESSES; ++j) {
+                const uint32_t index = builder.add_variable(fr(engine.get_random_uint32() % ARRAY_SIZE));
+                builder.read_ROM_array(rom_id, index);
+                if (j % 2 == 0) {
+                    builder.write_RAM_array(ram_id, index, builder.add_variable(fr(j)));
+                } else {
+                    builder.read_RAM_array(ram_id, index);
+                }
+            }
+        }
+        state.ResumeTiming();
+        builder.finalize_circuit();
+        DoNotOptimize(builder.num_gates);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(process_memory_arrays)->RangeMultiplier(4)->Range(16, 1024)->Unit(kMillisecond);
+
+/**
+ * @brief A circuit of add gates with no copy constraints, as a baseline for the cost of building gates.
+ */
+void add_gates(State& state) noexcept
+{
+    const auto num_gates = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        proof_system::StandardCircuitBuilder builder;
+        for (size_t i = 0; i < num_gates; ++i) {
+            const uint32_t a = builder.add_variable(fr(1));
+            const uint32_t b = builder.add_variable(fr(2));
+            const uint32_t c = builder.add_variable(fr(3));
+            builder.create_add_gate({ a, b, c, 1, 1, -1, 0 });
+        }
+        DoNotOptimize(builder.get_num_gates());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(add_gates)->RangeMultiplier(8)->Range(1 << 11, 1 << 17)->Unit(kMillisecond);
+
+/**
+ * @brief Append big add gates to an ultra circuit, whose 4 wires and 11 selectors each grow by one per gate, either with
+ * no size hint or with the final number of gates as the hint.
+ */
+void ultra_add_gates(State& state) noexcept
+{
+    const auto num_gates = static_cast<size_t>(state.range(0));
+    const bool with_size_hint = state.range(1) != 0;
+    for (auto _ : state) {
+        Builder builder(with_size_hint ? num_gates : 0);
+        const uint32_t a = builder.add_variable(fr(1));
+        for (size_t i = 0; i < num_gates; ++i) {
+            builder.create_big_add_gate({ a, a, a, a, 1, 1, 1, -3, 0 });
+        }
+        DoNotOptimize(builder.num_gates);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(ultra_add_gates)->ArgsProduct({ { 1 << 14, 1 << 17, 1 << 20 }, { 0, 1 } })->Unit(kMillisecond);
+
+} // namespace
+
+// NOLINTNEXTLINE macro invokation triggers style guideline errors from googletest code
+BENCHMARK_MAIN();
@@ -7,6 +7,9 @@ namespace proof_system {
 /**
  * Join variable class b to variable class a.
  *
+ * @details The merged class keeps the real variable, and hence the value, of class a. The trees of the classes are
+ * merged by rank, hanging the lower tree under the root of the higher one, so no member of either class is relabelled.
+ *
  * @param a_variable_idx Index of a variable in class a.
  * @param b_variable_idx Index of a variable in class b.
  * @param msg Class tag.
@@ -21,19 +24,25 @@ void CircuitBuilderBase<Arithmetization>::assert_equal(const uint32_t a_variable
     if (!values_equal && !failed()) {
         failure(msg);
     }
-    uint32_t a_real_idx = real_variable_index[a_variable_idx];
-    uint32_t b_real_idx = real_variable_index[b_variable_idx];
+    const uint32_t a_root = find_class_root(a_variable_idx);
+    const uint32_t b_root = find_class_root(b_variable_idx);
     // If a==b is already enforced, exit method
-    if (a_real_idx == b_real_idx)
+    if (a_root == b_root)
         return;
-    // Otherwise update the real_idx of b-chain members to that of a
+    uint32_t a_real_idx = class_real_variable_index[a_root];
+    uint32_t b_real_idx = class_real_variable_index[b_root];
+
+    const bool a_is_higher = var_class_rank[a_root] >= var_class_rank[b_root];
+    const uint32_t root = a_is_higher ? a_root : b_root;
+    const uint32_t child = a_is_higher ? b_root : a_root;
+    parent_var_index[child] = root;
+    if (var_class_rank[root] == var_class_rank[child]) {
+        ++var_class_rank[root];
+    }
+    class_real_variable_index[root] = a_real_idx;
+    // Swapping the successors of one member of each cycle joins the two cycles into one
+    std::swap(next_var_index[a_root], next_var_index[b_root]);
 
-    auto b_start_idx = get_first_variable_in_class(b_variable_idx);
-    update_real_variable_indices(b_start_idx, a_real_idx);
-    // Now merge equivalence classes of a and b by tying last (= real) element of b-chain to first element of a-chain
-    auto a_start_idx = get_first_variable_in_class(a_variable_idx);
-    next_var_index[b_real_idx] = a_start_idx;
-    prev_var_index[a_start_idx] = b_real_idx;
     bool no_tag_clash = (real_variable_tags[a_real_idx] == DUMMY_TAG || real_variable_tags[b_real_idx] == DUMMY_TAG ||
                          real_variable_tags[a_real_idx] == real_variable_tags[b_real_idx]);
     if (!no_tag_clash && !failed()) {
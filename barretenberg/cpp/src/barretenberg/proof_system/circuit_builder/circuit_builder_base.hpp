@@ -1,10 +1,11 @@
 #pragma once
-#include "barretenberg/common/slab_allocator.hpp"
+#include "barretenberg/common/block_vector.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/proof_system/arithmetization/arithmetization.hpp"
 #include "barretenberg/proof_system/arithmetization/gate_data.hpp"
 #include "barretenberg/serialize/cbind.hpp"
+#include <numeric>
 #include <utility>
 
 #include <unordered_map>
@@ -28,19 +29,22 @@ template <typename Arithmetization> class CircuitBuilderBase {
     std::vector<std::string> selector_names_;
     size_t num_gates = 0;
 
-    std::array<std::vector<uint32_t, barretenberg::ContainerSlabAllocator<uint32_t>>, NUM_WIRES> wires;
+    std::array<barretenberg::BlockVector<uint32_t>, NUM_WIRES> wires;
     typename Arithmetization::Selectors selectors;
 
     std::vector<uint32_t> public_inputs;
     std::vector<FF> variables;
     std::unordered_map<uint32_t, std::string> variable_names;
 
-    // index of next variable in equivalence class (=REAL_VARIABLE if you're last)
+    // The equivalence classes of variables under copy constraints form a union-find forest, whose roots are the
+    // representatives of the classes. The parent of each variable, or the variable itself if it is a root
+    std::vector<uint32_t> parent_var_index;
+    // Bound on the height of each root's tree, which keeps the trees balanced as classes merge
+    std::vector<uint8_t> var_class_rank;
+    // index of next variable in equivalence class, in a cycle through all the class's members
     std::vector<uint32_t> next_var_index;
-    // index of  previous variable in equivalence class (=FIRST if you're in a cycle alone)
-    std::vector<uint32_t> prev_var_index;
-    // indices of corresponding real variables
-    std::vector<uint32_t> real_variable_index;
+    // index of the real variable of each class, indexed by the class's root
+    std::vector<uint32_t> class_real_variable_index;
     std::vector<uint32_t> real_variable_tags;
     uint32_t current_tag = DUMMY_TAG;
     // The permutation on variable tags. See
@@ -54,8 +58,6 @@ template <typename Arithmetization> class CircuitBuilderBase {
 
     bool _failed = false;
     std::string _err;
-    static constexpr uint32_t REAL_VARIABLE = UINT32_MAX - 1;
-    static constexpr uint32_t FIRST_VARIABLE_IN_CLASS = UINT32_MAX - 2;
 
     // Enum values spaced in increments of 30-bits (multiples of 2 ** 30).
     // TODO(#216)(Adrian): This is unused, and this type of hard coded data should be avoided
@@ -67,9 +69,10 @@ template <typename Arithmetization> class CircuitBuilderBase {
     {
         variables.reserve(size_hint * 3);
         variable_names.reserve(size_hint * 3);
+        parent_var_index.reserve(size_hint * 3);
+        var_class_rank.reserve(size_hint * 3);
         next_var_index.reserve(size_hint * 3);
-        prev_var_index.reserve(size_hint * 3);
-        real_variable_index.reserve(size_hint * 3);
+        class_real_variable_index.reserve(size_hint * 3);
         real_variable_tags.reserve(size_hint * 3);
         // We set selectors type to bool, when we don't actually use them
         if constexpr (!std::is_same<typename Arithmetization::Selectors, bool>::value) {
@@ -85,6 +88,21 @@ template <typename Arithmetization> class CircuitBuilderBase {
     CircuitBuilderBase& operator=(CircuitBuilderBase&& other) noexcept = default;
     virtual ~CircuitBuilderBase() = default;
 
+    /**
+     * @brief Merge the blocks of each wire and selector into one contiguous span, once no more gates will be added
+     */
+    void make_gate_columns_contiguous()
+    {
+        for (auto& wire : wires) {
+            wire.make_contiguous();
+        }
+        if constexpr (!std::is_same<typename Arithmetization::Selectors, bool>::value) {
+            for (auto& selector : selectors) {
+                selector.make_contiguous();
+            }
+        }
+    }
+
     virtual size_t get_num_gates() const { return num_gates; }
     virtual void print_num_gates() const { std::cout << num_gates << std::endl; }
     virtual size_t get_num_variables() const { return variables.size(); }
@@ -99,32 +117,72 @@ template <typename Arithmetization> class CircuitBuilderBase {
     virtual size_t get_num_constant_gates() const = 0;
 
     /**
-     * Get the index of the first variable in class.
+     * Get the root of the variable's class, which represents the class.
+     *
+     * @details The trees are merged by rank, so this takes at most log2 of the number of variables steps.
      *
      * @param index The index of the variable you want to look up.
      *
-     * @return The index of the first variable in the same class as the submitted index.
+     * @return The index of the root of the class of the submitted index.
      * */
-    uint32_t get_first_variable_in_class(uint32_t index) const
+    uint32_t get_class_root(uint32_t index) const
     {
-        while (prev_var_index[index] != FIRST_VARIABLE_IN_CLASS) {
-            index = prev_var_index[index];
+        while (parent_var_index[index] != index) {
+            index = parent_var_index[index];
         }
         return index;
     }
+
     /**
-     * Update all variables from index in equivalence class to have real variable new_real_index.
-     *
-     * @param index The index of a variable in the class we're updating.
-     * @param new_real_index The index of the real variable to update to.
+     * Get the root of the variable's class, halving the path to it on the way so that later look-ups take fewer
+     * steps.
+     * */
+    uint32_t find_class_root(uint32_t index)
+    {
+        while (parent_var_index[index] != index) {
+            parent_var_index[index] = parent_var_index[parent_var_index[index]];
+            index = parent_var_index[index];
+        }
+        return index;
+    }
+
+    /**
+     * Get the index of the real variable of the variable's class, whose value all the class's variables take.
      * */
-    void update_real_variable_indices(uint32_t index, uint32_t new_real_index)
+    uint32_t get_real_variable_index(const uint32_t index) const
     {
-        auto cur_index = index;
-        do {
-            real_variable_index[cur_index] = new_real_index;
-            cur_index = next_var_index[cur_index];
-        } while (cur_index != REAL_VARIABLE);
+        return class_real_variable_index[get_class_root(index)];
+    }
+
+    /**
+     * Get the index of the real variable of every variable, resolving all copy constraints at once, e.g. to compute
+     * the copy cycles of the permutation argument.
+     * */
+    std::vector<uint32_t> get_real_variable_indices() const
+    {
+        std::vector<uint32_t> roots(parent_var_index.size());
+        // Parents may follow their children, so resolve each path in full once and record its root on the way back
+        std::vector<uint32_t> path;
+        static constexpr uint32_t UNRESOLVED = UINT32_MAX;
+        std::fill(roots.begin(), roots.end(), UNRESOLVED);
+        for (uint32_t i = 0; i < roots.size(); ++i) {
+            uint32_t index = i;
+            while (roots[index] == UNRESOLVED && parent_var_index[index] != index) {
+                path.push_back(index);
+                index = parent_var_index[index];
+            }
+            const uint32_t root = roots[index] == UNRESOLVED ? index : roots[index];
+            roots[index] = root;
+            for (const auto& node : path) {
+                roots[node] = root;
+            }
+            path.clear();
+        }
+        std::vector<uint32_t> result(roots.size());
+        for (size_t i = 0; i < roots.size(); ++i) {
+            result[i] = class_real_variable_index[roots[i]];
+        }
+        return result;
     }
 
     /**
@@ -137,7 +195,7 @@ template <typename Arithmetization> class CircuitBuilderBase {
     inline FF get_variable(const uint32_t index) const
     {
         ASSERT(variables.size() > index);
-        return variables[real_variable_index[index]];
+        return variables[get_real_variable_index(index)];
     }
 
     /**
@@ -151,14 +209,14 @@ template <typename Arithmetization> class CircuitBuilderBase {
     inline const FF& get_variable_reference(const uint32_t index) const
     {
         ASSERT(variables.size() > index);
-        return variables[real_variable_index[index]];
+        return variables[get_real_variable_index(index)];
     }
 
     uint32_t get_public_input_index(const uint32_t witness_index) const
     {
         uint32_t result = static_cast<uint32_t>(-1);
         for (size_t i = 0; i < public_inputs.size(); ++i) {
-            if (real_variable_index[public_inputs[i]] == real_variable_index[witness_index]) {
+            if (get_class_root(public_inputs[i]) == get_class_root(witness_index)) {
                 result = static_cast<uint32_t>(i);
                 break;
             }
@@ -191,13 +249,35 @@ template <typename Arithmetization> class CircuitBuilderBase {
         // By default, we assume each new variable belongs in its own copy-cycle. These defaults can be modified later
         // by `assert_equal`.
         const uint32_t index = static_cast<uint32_t>(variables.size()) - 1U;
-        real_variable_index.emplace_back(index);
-        next_var_index.emplace_back(REAL_VARIABLE);
-        prev_var_index.emplace_back(FIRST_VARIABLE_IN_CLASS);
+        parent_var_index.emplace_back(index);
+        var_class_rank.emplace_back(0);
+        next_var_index.emplace_back(index);
+        class_real_variable_index.emplace_back(index);
         real_variable_tags.emplace_back(DUMMY_TAG);
         return index;
     }
 
+    /**
+     * @brief Add num_new_variables variables of value zero, each in a copy cycle of its own, for the caller to set.
+     *
+     * @details Lets a caller that knows how many variables it needs reserve them at once, and then fill them in
+     * parallel.
+     * @return The index of the first new variable
+     */
+    uint32_t add_variables(const size_t num_new_variables)
+    {
+        const auto first_index = static_cast<uint32_t>(variables.size());
+        const size_t new_size = variables.size() + num_new_variables;
+        variables.resize(new_size, FF(0));
+        for (auto* indices : { &parent_var_index, &next_var_index, &class_real_variable_index }) {
+            indices->resize(new_size);
+            std::iota(indices->begin() + static_cast<std::ptrdiff_t>(first_index), indices->end(), first_index);
+        }
+        var_class_rank.resize(new_size, 0);
+        real_variable_tags.resize(new_size, DUMMY_TAG);
+        return first_index;
+    }
+
     /**
      * Assign a name to a variable(equivalence class). Should be one name per equivalence class.
      *
@@ -208,42 +288,42 @@ template <typename Arithmetization> class CircuitBuilderBase {
     virtual void set_variable_name(uint32_t index, const std::string& name)
     {
         ASSERT(variables.size() > index);
-        uint32_t first_idx = get_first_variable_in_class(index);
+        uint32_t root_idx = get_class_root(index);
 
-        if (variable_names.contains(first_idx)) {
+        if (variable_names.contains(root_idx)) {
             failure("Attempted to assign a name to a variable that already has a name");
             return;
         }
-        variable_names.insert({ first_idx, name });
+        variable_names.insert({ root_idx, name });
     }
 
     /**
      * After assert_equal() merge two class names if present.
-     * Preserves the first name in class.
+     * Preserves the name of the class's root.
      *
      * @param index Index of the variable you have previously named and used in assert_equal.
      *
      */
     virtual void update_variable_names(uint32_t index)
     {
-        uint32_t first_idx = get_first_variable_in_class(index);
+        uint32_t root_idx = get_class_root(index);
 
-        uint32_t cur_idx = next_var_index[first_idx];
-        while (cur_idx != REAL_VARIABLE && !variable_names.contains(cur_idx)) {
+        uint32_t cur_idx = next_var_index[root_idx];
+        while (cur_idx != root_idx && !variable_names.contains(cur_idx)) {
             cur_idx = next_var_index[cur_idx];
         }
 
-        if (variable_names.contains(first_idx)) {
-            if (cur_idx != REAL_VARIABLE) {
+        if (variable_names.contains(root_idx)) {
+            if (cur_idx != root_idx) {
                 variable_names.extract(cur_idx);
             }
             return;
         }
 
-        if (cur_idx != REAL_VARIABLE) {
+        if (cur_idx != root_idx) {
             std::string var_name = variable_names.find(cur_idx)->second;
             variable_names.erase(cur_idx);
-            variable_names.insert({ first_idx, var_name });
+            variable_names.insert({ root_idx, var_name });
             return;
         }
         failure("No previously assigned names found");
@@ -261,7 +341,7 @@ template <typename Arithmetization> class CircuitBuilderBase {
 
         for (auto& tup : variable_names) {
             keys.push_back(tup.first);
-            firsts.push_back(get_first_variable_in_class(tup.first));
+            firsts.push_back(get_class_root(tup.first));
         }
 
         for (size_t i = 0; i < keys.size() - 1; i++) {
@@ -388,7 +468,7 @@ template <typename Arithmetization> class CircuitBuilderBase {
         contains_recursive_proof = true;
         for (size_t i = 0; i < proof_output_witness_indices.size(); ++i) {
             recursive_proof_public_input_indices.push_back(
-                get_public_input_index(real_variable_index[proof_output_witness_indices[i]]));
+                get_public_input_index(get_real_variable_index(proof_output_witness_indices[i])));
         }
     }
 
@@ -544,24 +624,22 @@ template <typename Arithmetization> class CircuitBuilderBase {
  * These vectors imply copy-cycles between variables. ("copy-cycle" meaning "a set of variables which must always be
  * equal"). The indices of these vectors correspond to those of the `variables` vector. Each index contains
  * information about the corresponding variable.
- *   - next_var_index = [ -1,  -1,  -1,  -1,  -1,  -1,  -1,   6]
- *   - prev_var_index = [ -2,  -2,  -2,  -2,  -2,  -2,   7,  -2]
- *   - real_var_index = [  0,   1,   2,   3,   4,   5,   6,   6] <-- Notice this repeated 6.
+ *   - parent_var_index           = [  0,   1,   2,   3,   4,   5,   6,   6] <-- Notice this repeated 6.
+ *   - next_var_index             = [  0,   1,   2,   3,   4,   5,   7,   6]
+ *   - class_real_variable_index  = [  0,   1,   2,   3,   4,   5,   6,   7]
  *
- *   `-1` = "The variable at this index is considered the last in its cycle (no next variable exists)"
- *          Note: we (arbitrarily) consider the "last" variable in a cycle to be the true representative of its
- *          cycle, and so dub it the "real" variable of the cycle.
- *   `-2` = "The variable at this index is considered the first in its cycle (no previous variable exists)"
- *   Any other number denotes the index of another variable in the cycle = "The variable at this index is equal to
- *   the variable at this other index".
+ *   The classes are the trees of a union-find forest: `parent_var_index` points each variable to its parent, and
+ *   the roots of the trees, which point to themselves, represent the classes. `next_var_index` links the members of
+ *   each class in a cycle, so that they can be enumerated. `class_real_variable_index` is only meaningful at a root:
+ *   it holds the index of the "real" variable whose value all the members of the class take.
  *
- * By default, when a variable is added to the composer, we assume the variable is in a copy-cycle of its own. So
- * we set `next_var_index = -1`, `prev_var_index = -2`, `real_var_index` = the index of the variable in `variables`.
- * You can see in our example that all but the last two indices of each *_index vector contain the default values.
- * In our example, we have `variables[6].assert_equal(variables[7])`. The `assert_equal` function modifies the above
- * vectors' entries for variables 6 & 7 to imply a copy-cycle between them. Arbitrarily, variables[7] is deemed the
- * "first" in the cycle and variables[6] is considered the last (and hence the "real" variable which represents the
- * cycle).
+ * By default, when a variable is added to the composer, we assume the variable is in a copy-cycle of its own. So it
+ * is its own parent, its own next variable and its own real variable. In our example, we have
+ * `variables[6].assert_equal(variables[7])`. The `assert_equal` function hangs the tree of 7 under the root 6, joins
+ * the two cycles, and keeps the real variable of the first argument, 6, as the real variable of the merged class.
+ * It never relabels the members of a class, so merging into a large class costs no more than merging into a small
+ * one; the real variable of each variable is resolved by walking up to its root, and for all the variables at once
+ * by `get_real_variable_indices` when the copy cycles are computed.
  *
  * By the time we get to computing wire copy-cycles, we need to allow for public_inputs, which in the plonk protocol
  * are positioned to be the first witness values. `variables` doesn't include these public inputs (they're stored
@@ -571,7 +649,7 @@ template <typename Arithmetization> class CircuitBuilderBase {
  * up by the number of public inputs (by 1 in this example)):
  *   - wire_copy_cycles = [
  *         // The i-th index of `wire_copy_cycles` details the set of wires which all equal
- *         // variables[real_var_index[i]]. (I.e. equal to the i-th "real" variable):
+ *         // variables[i], for each "real" variable i:
  *         [
  *             { gate_index: 1, left   }, // w_l[1-#pub] = w_l[0] -> variables[0] = 0 <-- tag = 1 (id_mapping)
  *             { gate_index: 1, right  }, // w_r[1-#pub] = w_r[0] -> variables[0] = 0
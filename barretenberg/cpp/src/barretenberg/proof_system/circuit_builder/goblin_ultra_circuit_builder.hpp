@@ -34,7 +34,7 @@ template <typename FF> class GoblinUltraCircuitBuilder_ : public UltraCircuitBui
     uint32_t mul_accum_op_idx;
     uint32_t equality_op_idx;
 
-    using WireVector = std::vector<uint32_t, ContainerSlabAllocator<uint32_t>>;
+    using WireVector = BlockVector<uint32_t>;
 
     // Wires storing ecc op queue data; values are indices into the variables array
     std::array<WireVector, arithmetization::Ultra<FF>::NUM_WIRES> ecc_op_wires;
@@ -531,11 +531,11 @@ template <typename FF> msgpack::sbuffer StandardCircuitBuilder_<FF>::export_circ
     cir.modulus = buf.str();
 
     for (uint32_t i = 0; i < this->get_num_public_inputs(); i++) {
-        cir.public_inps.push_back(this->real_variable_index[this->public_inputs[i]]);
+        cir.public_inps.push_back(this->get_real_variable_index(this->public_inputs[i]));
     }
 
     for (auto& tup : base::variable_names) {
-        cir.vars_of_interest.insert({ this->real_variable_index[tup.first], tup.second });
+        cir.vars_of_interest.insert({ this->get_real_variable_index(tup.first), tup.second });
     }
 
     for (auto var : this->variables) {
@@ -545,9 +545,9 @@ template <typename FF> msgpack::sbuffer StandardCircuitBuilder_<FF>::export_circ
     for (size_t i = 0; i < this->num_gates; i++) {
         std::vector<FF> tmp_sel = { q_m[i], q_1[i], q_2[i], q_3[i], q_c[i] };
         std::vector<uint32_t> tmp_w = {
-            this->real_variable_index[w_l[i]],
-            this->real_variable_index[w_r[i]],
-            this->real_variable_index[w_o[i]],
+            this->get_real_variable_index(w_l[i]),
+            this->get_real_variable_index(w_r[i]),
+            this->get_real_variable_index(w_o[i]),
         };
         cir.selectors.push_back(tmp_sel);
         cir.wires.push_back(tmp_w);
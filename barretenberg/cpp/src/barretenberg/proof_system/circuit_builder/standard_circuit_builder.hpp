@@ -21,8 +21,8 @@ template <typename FF> class StandardCircuitBuilder_ : public CircuitBuilderBase
     static constexpr merkle::HashType merkle_hash_type = merkle::HashType::FIXED_BASE_PEDERSEN;
     static constexpr pedersen::CommitmentType commitment_type = pedersen::CommitmentType::FIXED_BASE_PEDERSEN;
 
-    using WireVector = std::vector<uint32_t, barretenberg::ContainerSlabAllocator<uint32_t>>;
-    using SelectorVector = std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>;
+    using WireVector = barretenberg::BlockVector<uint32_t>;
+    using SelectorVector = barretenberg::BlockVector<FF>;
 
     WireVector& w_l = std::get<0>(this->wires);
     WireVector& w_r = std::get<1>(this->wires);
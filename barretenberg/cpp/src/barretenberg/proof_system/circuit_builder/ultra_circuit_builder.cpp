@@ -6,9 +6,13 @@
  *
  */
 #include "ultra_circuit_builder.hpp"
+#include "barretenberg/common/thread.hpp"
 #include <barretenberg/plonk/proof_system/constants.hpp>
+#include <algorithm>
+#include <atomic>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 
 using namespace barretenberg;
 
@@ -47,6 +51,7 @@ template <typename FF> void UltraCircuitBuilder_<FF>::finalize_circuit()
         process_RAM_arrays();
         process_range_lists();
         circuit_finalised = true;
+        this->make_gate_columns_contiguous();
     }
 }
 
@@ -575,9 +580,10 @@ template <typename FF> plookup::BasicTable& UltraCircuitBuilder_<FF>::get_table(
             return table;
         }
     }
-    // Table doesn't exist! So try to create it.
-    lookup_tables.emplace_back(plookup::create_basic_table(id, lookup_tables.size()));
-    return lookup_tables[lookup_tables.size() - 1];
+    // Table doesn't exist! So add it, sharing the columns of the process-wide copy.
+    plookup::BasicTable& table = lookup_tables.emplace_back(plookup::get_shared_basic_table(id));
+    table.table_index = lookup_tables.size() - 1;
+    return table;
 }
 
 /**
@@ -597,7 +603,11 @@ plookup::ReadData<uint32_t> UltraCircuitBuilder_<FF>::create_gates_from_plookup_
     for (size_t i = 0; i < num_lookups; ++i) {
         auto& table = get_table(multi_table.lookup_ids[i]);
 
-        table.lookup_gates.emplace_back(read_values.key_entries[i]);
+        const auto row = table.row_index.find(read_values.key_entries[i].key);
+        if (!row.has_value() && !this->failed()) {
+            this->failure("lookup key is not in the table");
+        }
+        table.lookup_gates.emplace_back(row.value_or(0));
 
         const auto first_idx = (i == 0) ? key_a_index : this->add_variable(read_values[plookup::ColumnIdx::C1][i]);
         const auto second_idx = (i == 0 && (key_b_index.has_value()))
@@ -796,7 +806,7 @@ void UltraCircuitBuilder_<FF>::create_new_range_constraint(const uint32_t variab
         range_lists.insert({ target_range, create_range_list(target_range) });
     }
 
-    const auto existing_tag = this->real_variable_tags[this->real_variable_index[variable_index]];
+    const auto existing_tag = this->real_variable_tags[this->get_real_variable_index(variable_index)];
     auto& list = range_lists[target_range];
 
     // If the variable's tag matches the target range list's tag, do nothing.
@@ -836,7 +846,60 @@ void UltraCircuitBuilder_<FF>::create_new_range_constraint(const uint32_t variab
     }
 }
 
-template <typename FF> void UltraCircuitBuilder_<FF>::process_range_list(RangeList& list)
+namespace {
+/**
+ * @brief Sort 32-bit values with a least-significant-digit radix sort, over two 16-bit digits.
+ */
+void radix_sort(std::vector<uint32_t>& values)
+{
+    constexpr uint32_t DIGIT_BITS = 16;
+    constexpr uint32_t DIGIT_MASK = (1U << DIGIT_BITS) - 1;
+    std::vector<uint32_t> buffer(values.size());
+    std::vector<size_t> offsets(DIGIT_MASK + 1);
+    for (uint32_t shift = 0; shift < 32; shift += DIGIT_BITS) {
+        std::fill(offsets.begin(), offsets.end(), 0);
+        for (const auto value : values) {
+            ++offsets[(value >> shift) & DIGIT_MASK];
+        }
+        size_t offset = 0;
+        for (auto& digit_offset : offsets) {
+            offset += std::exchange(digit_offset, offset);
+        }
+        for (const auto value : values) {
+            buffer[offsets[(value >> shift) & DIGIT_MASK]++] = value;
+        }
+        values.swap(buffer);
+    }
+}
+
+/**
+ * @brief Sort values with a counting sort if they span a small range next to their number, e.g. the values of a
+ * satisfied range list, and with a radix sort otherwise.
+ */
+void sort_small_range(std::vector<uint32_t>& values)
+{
+    const uint32_t max_value = values.empty() ? 0 : *std::max_element(values.begin(), values.end());
+    if (max_value > 4 * values.size() + (1UL << 16)) {
+        radix_sort(values);
+        return;
+    }
+    std::vector<uint32_t> counts(static_cast<size_t>(max_value) + 1);
+    for (const auto value : values) {
+        ++counts[value];
+    }
+    auto it = values.begin();
+    for (uint32_t value = 0; value <= max_value; ++value) {
+        it = std::fill_n(it, counts[value], value);
+    }
+}
+} // namespace
+
+/**
+ * @brief Remove the duplicate variables of a range list, and return the values of the rest in ascending order.
+ */
+template <typename FF>
+std::vector<uint32_t> UltraCircuitBuilder_<FF>::sort_range_list(RangeList& list,
+                                                                const std::vector<uint32_t>& real_variable_index)
 {
     this->assert_valid_variables(list.variable_indices);
 
@@ -846,55 +909,142 @@ template <typename FF> void UltraCircuitBuilder_<FF>::process_range_list(RangeLi
     // applied on a variable after it was range constrained, this makes sure the indices in list point to the updated
     // index in the range list so the set equivalence does not fail
     for (uint32_t& x : list.variable_indices) {
-        x = this->real_variable_index[x];
+        x = real_variable_index[x];
     }
     // remove duplicate witness indices to prevent the sorted list set size being wrong!
-    std::sort(list.variable_indices.begin(), list.variable_indices.end());
+    radix_sort(list.variable_indices);
     auto back_iterator = std::unique(list.variable_indices.begin(), list.variable_indices.end());
     list.variable_indices.erase(back_iterator, list.variable_indices.end());
 
-    // go over variables
-    // iterate over each variable and create mirror variable with same value - with tau tag
-    // need to make sure that, in original list, increments of at most 3
     std::vector<uint32_t> sorted_list;
     sorted_list.reserve(list.variable_indices.size());
     for (const auto variable_index : list.variable_indices) {
-        const auto& field_element = this->get_variable(variable_index);
+        const auto& field_element = this->variables[variable_index];
         const uint32_t shrinked_value = (uint32_t)field_element.from_montgomery_form().data[0];
         sorted_list.emplace_back(shrinked_value);
     }
+    sort_small_range(sorted_list);
+    return sorted_list;
+}
 
-#ifdef NO_TBB
-    std::sort(sorted_list.begin(), sorted_list.end());
-#else
-    std::sort(std::execution::par_unseq, sorted_list.begin(), sorted_list.end());
-#endif
-    // list must be padded to a multipe of 4 and larger than 4 (gate_width)
+/**
+ * @brief For each range list, add a sort constraint from 0 to the list's range on mirror variables of its variables,
+ * sorted and tagged with the list's tau tag, so that the tags' permutation argument links the two.
+ *
+ * @details The lists are independent. Each is sorted on a thread of its own; then the variables and gates of all of
+ * them are reserved at once and filled in parallel, in chunks of gates, each list into its own slots. The result is the
+ * same as processing the lists one after the other in order of range.
+ */
+template <typename FF> void UltraCircuitBuilder_<FF>::process_range_lists()
+{
     constexpr size_t gate_width = plonk::ultra_settings::program_width;
-    size_t padding = (gate_width - (list.variable_indices.size() % gate_width)) % gate_width;
-
-    std::vector<uint32_t> indices;
-    indices.reserve(padding + sorted_list.size());
-
-    if (list.variable_indices.size() <= gate_width) {
-        padding += gate_width;
-    }
-    for (size_t i = 0; i < padding; ++i) {
-        indices.emplace_back(this->zero_idx);
-    }
-    for (const auto sorted_value : sorted_list) {
-        const uint32_t index = this->add_variable(sorted_value);
-        assign_tag(index, list.tau_tag);
-        indices.emplace_back(index);
+    std::vector<RangeList*> lists;
+    for (auto& [target_range, list] : range_lists) {
+        lists.emplace_back(&list);
+    }
+    if (lists.empty()) {
+        return;
+    }
+
+    // Resolve every variable at once, rather than each list element on its own
+    const std::vector<uint32_t> real_variable_index = this->get_real_variable_indices();
+    std::vector<std::vector<uint32_t>> sorted_lists(lists.size());
+    parallel_for(lists.size(), [&](size_t i) { sorted_lists[i] = sort_range_list(*lists[i], real_variable_index); });
+
+    // The sort constraint of a list has rows of its sorted variables, padded at the front with zeros to a multiple of
+    // the gate width and to more than one row, and then a gate for the end condition
+    struct ListSlots {
+        size_t padding;
+        uint32_t first_variable;
+        size_t first_gate;
+        size_t num_gates;
+    };
+    std::vector<ListSlots> slots(lists.size());
+    size_t num_new_variables = 0;
+    size_t num_new_gates = 0;
+    for (size_t i = 0; i < lists.size(); ++i) {
+        const size_t num_values = sorted_lists[i].size();
+        size_t padding = (gate_width - (num_values % gate_width)) % gate_width;
+        if (num_values <= gate_width) {
+            padding += gate_width;
+        }
+        slots[i] = { .padding = padding,
+                     .first_variable = static_cast<uint32_t>(num_new_variables),
+                     .first_gate = this->num_gates + num_new_gates,
+                     .num_gates = (padding + num_values) / gate_width + 1 };
+        num_new_variables += num_values;
+        num_new_gates += slots[i].num_gates;
+    }
+    const uint32_t first_new_variable = this->add_variables(num_new_variables);
+    for (auto& list_slots : slots) {
+        list_slots.first_variable += first_new_variable;
+    }
+    add_empty_gates(num_new_gates);
+
+    // Split long lists between threads
+    constexpr size_t GATES_PER_CHUNK = 1 << 12;
+    struct Chunk {
+        size_t list;
+        size_t start;
+        size_t end;
+    };
+    std::vector<Chunk> chunks;
+    for (size_t i = 0; i < lists.size(); ++i) {
+        for (size_t start = 0; start < slots[i].num_gates; start += GATES_PER_CHUNK) {
+            chunks.push_back(
+                { .list = i, .start = start, .end = std::min(start + GATES_PER_CHUNK, slots[i].num_gates) });
+        }
     }
-    create_sort_constraint_with_edges(indices, 0, list.target_range);
+    parallel_for(chunks.size(), [&](size_t chunk_idx) {
+        const Chunk& chunk = chunks[chunk_idx];
+        const RangeList& list = *lists[chunk.list];
+        const std::vector<uint32_t>& sorted_list = sorted_lists[chunk.list];
+        const ListSlots& list_slots = slots[chunk.list];
+        const size_t num_rows = list_slots.num_gates - 1;
+        // Set the i-th variable of the padded list, and return its index
+        const auto set_variable = [&](size_t i) {
+            if (i < list_slots.padding) {
+                return this->zero_idx;
+            }
+            const uint32_t index = list_slots.first_variable + static_cast<uint32_t>(i - list_slots.padding);
+            this->variables[index] = FF(sorted_list[i - list_slots.padding]);
+            this->real_variable_tags[index] = list.tau_tag;
+            return index;
+        };
+        for (size_t gate = chunk.start; gate < chunk.end; ++gate) {
+            const size_t row = list_slots.first_gate + gate;
+            if (gate < num_rows) {
+                for (size_t j = 0; j < gate_width; ++j) {
+                    this->wires[j][row] = set_variable(gate * gate_width + j);
+                }
+                q_sort[row] = 1;
+                // The first row starts at 0
+                if (gate == 0) {
+                    q_1[row] = 1;
+                    q_arith[row] = 1;
+                }
+            } else {
+                // The sort widget reads this gate as the row after the last, and it checks the end condition
+                w_l[row] = list_slots.first_variable + static_cast<uint32_t>(sorted_list.size() - 1);
+                q_1[row] = 1;
+                q_c[row] = -FF(list.target_range);
+                q_arith[row] = 1;
+            }
+        }
+    });
 }
 
-template <typename FF> void UltraCircuitBuilder_<FF>::process_range_lists()
+template <typename FF> size_t UltraCircuitBuilder_<FF>::add_empty_gates(const size_t num_new_gates)
 {
-    for (auto& i : range_lists) {
-        process_range_list(i.second);
+    const size_t first_gate = this->num_gates;
+    this->num_gates += num_new_gates;
+    for (auto& wire : this->wires) {
+        wire.resize(this->num_gates, this->zero_idx);
+    }
+    for (auto& selector : this->selectors) {
+        selector.resize(this->num_gates, FF(0));
     }
+    return first_gate;
 }
 
 /*
@@ -1176,59 +1326,45 @@ std::vector<uint32_t> UltraCircuitBuilder_<FF>::decompose_into_default_range_bet
  */
 template <typename FF> void UltraCircuitBuilder_<FF>::apply_aux_selectors(const AUX_SELECTORS type)
 {
-    q_aux.emplace_back(type == AUX_SELECTORS::NONE ? 0 : 1);
-    q_sort.emplace_back(0);
-    q_lookup_type.emplace_back(0);
-    q_elliptic.emplace_back(0);
+    for (auto& selector : this->selectors) {
+        selector.emplace_back(0);
+    }
+    set_aux_selectors(q_aux.size() - 1, type);
+}
+
+/**
+ * @brief Set the selectors of an existing gate, whose selectors are all zero, to those of an auxiliary gate
+ *
+ * @details See apply_aux_selectors for the selectors of each gate type.
+ */
+template <typename FF>
+void UltraCircuitBuilder_<FF>::set_aux_selectors(const size_t gate_index, const AUX_SELECTORS type)
+{
+    q_aux[gate_index] = type == AUX_SELECTORS::NONE ? 0 : 1;
     switch (type) {
     case AUX_SELECTORS::LIMB_ACCUMULATE_1: {
-        q_1.emplace_back(0);
-        q_2.emplace_back(0);
-        q_3.emplace_back(1);
-        q_4.emplace_back(1);
-        q_m.emplace_back(0);
-        q_c.emplace_back(0);
-        q_arith.emplace_back(0);
+        q_3[gate_index] = 1;
+        q_4[gate_index] = 1;
         break;
     }
     case AUX_SELECTORS::LIMB_ACCUMULATE_2: {
-        q_1.emplace_back(0);
-        q_2.emplace_back(0);
-        q_3.emplace_back(1);
-        q_4.emplace_back(0);
-        q_m.emplace_back(1);
-        q_c.emplace_back(0);
-        q_arith.emplace_back(0);
+        q_3[gate_index] = 1;
+        q_m[gate_index] = 1;
         break;
     }
     case AUX_SELECTORS::NON_NATIVE_FIELD_1: {
-        q_1.emplace_back(0);
-        q_2.emplace_back(1);
-        q_3.emplace_back(1);
-        q_4.emplace_back(0);
-        q_m.emplace_back(0);
-        q_c.emplace_back(0);
-        q_arith.emplace_back(0);
+        q_2[gate_index] = 1;
+        q_3[gate_index] = 1;
         break;
     }
     case AUX_SELECTORS::NON_NATIVE_FIELD_2: {
-        q_1.emplace_back(0);
-        q_2.emplace_back(1);
-        q_3.emplace_back(0);
-        q_4.emplace_back(1);
-        q_m.emplace_back(0);
-        q_c.emplace_back(0);
-        q_arith.emplace_back(0);
+        q_2[gate_index] = 1;
+        q_4[gate_index] = 1;
         break;
     }
     case AUX_SELECTORS::NON_NATIVE_FIELD_3: {
-        q_1.emplace_back(0);
-        q_2.emplace_back(1);
-        q_3.emplace_back(0);
-        q_4.emplace_back(0);
-        q_m.emplace_back(1);
-        q_c.emplace_back(0);
-        q_arith.emplace_back(0);
+        q_2[gate_index] = 1;
+        q_m[gate_index] = 1;
         break;
     }
     case AUX_SELECTORS::ROM_CONSISTENCY_CHECK: {
@@ -1236,13 +1372,8 @@ template <typename FF> void UltraCircuitBuilder_<FF>::apply_aux_selectors(const
         // Apply sorted memory read checks with the following additional check:
         // 1. Assert that if index field across two gates does not change, the value field does not change.
         // Used for ROM reads and RAM reads across write/read boundaries
-        q_1.emplace_back(1);
-        q_2.emplace_back(1);
-        q_3.emplace_back(0);
-        q_4.emplace_back(0);
-        q_m.emplace_back(0);
-        q_c.emplace_back(0);
-        q_arith.emplace_back(0);
+        q_1[gate_index] = 1;
+        q_2[gate_index] = 1;
         break;
     }
     case AUX_SELECTORS::RAM_CONSISTENCY_CHECK: {
@@ -1251,74 +1382,42 @@ template <typename FF> void UltraCircuitBuilder_<FF>::apply_aux_selectors(const
         // 2. Validate record computation (r = read_write_flag + index * \eta + \timestamp * \eta^2 + value * \eta^3)
         // 3. If adjacent index values across 2 gates does not change, and the next gate's read_write_flag is set to
         // 'read', validate adjacent values do not change Used for ROM reads and RAM reads across read/write boundaries
-        q_1.emplace_back(0);
-        q_2.emplace_back(0);
-        q_3.emplace_back(0);
-        q_4.emplace_back(0);
-        q_m.emplace_back(0);
-        q_c.emplace_back(0);
-        q_arith.emplace_back(1);
+        q_arith[gate_index] = 1;
         break;
     }
     case AUX_SELECTORS::RAM_TIMESTAMP_CHECK: {
         // For two adjacent RAM entries that share the same index, validate the timestamp value is monotonically
         // increasing
-        q_1.emplace_back(1);
-        q_2.emplace_back(0);
-        q_3.emplace_back(0);
-        q_4.emplace_back(1);
-        q_m.emplace_back(0);
-        q_c.emplace_back(0);
-        q_arith.emplace_back(0);
+        q_1[gate_index] = 1;
+        q_4[gate_index] = 1;
         break;
     }
     case AUX_SELECTORS::ROM_READ: {
         // Memory read gate for reading memory cells.
         // Validates record witness computation (r = read_write_flag + index * \eta + timestamp * \eta^2 + value *
         // \eta^3)
-        q_1.emplace_back(1);
-        q_2.emplace_back(0);
-        q_3.emplace_back(0);
-        q_4.emplace_back(0);
-        q_m.emplace_back(1); // validate record witness is correctly computed
-        q_c.emplace_back(0); // read/write flag stored in q_c
-        q_arith.emplace_back(0);
+        q_1[gate_index] = 1;
+        q_m[gate_index] = 1; // validate record witness is correctly computed
         break;
     }
     case AUX_SELECTORS::RAM_READ: {
         // Memory read gate for reading memory cells.
         // Validates record witness computation (r = read_write_flag + index * \eta + timestamp * \eta^2 + value *
         // \eta^3)
-        q_1.emplace_back(1);
-        q_2.emplace_back(0);
-        q_3.emplace_back(0);
-        q_4.emplace_back(0);
-        q_m.emplace_back(1); // validate record witness is correctly computed
-        q_c.emplace_back(0); // read/write flag stored in q_c
-        q_arith.emplace_back(0);
+        q_1[gate_index] = 1;
+        q_m[gate_index] = 1; // validate record witness is correctly computed
         break;
     }
     case AUX_SELECTORS::RAM_WRITE: {
         // Memory read gate for writing memory cells.
         // Validates record witness computation (r = read_write_flag + index * \eta + timestamp * \eta^2 + value *
         // \eta^3)
-        q_1.emplace_back(1);
-        q_2.emplace_back(0);
-        q_3.emplace_back(0);
-        q_4.emplace_back(0);
-        q_m.emplace_back(1); // validate record witness is correctly computed
-        q_c.emplace_back(1); // read/write flag stored in q_c
-        q_arith.emplace_back(0);
+        q_1[gate_index] = 1;
+        q_m[gate_index] = 1; // validate record witness is correctly computed
+        q_c[gate_index] = 1; // read/write flag stored in q_c
         break;
     }
     default: {
-        q_1.emplace_back(0);
-        q_2.emplace_back(0);
-        q_3.emplace_back(0);
-        q_4.emplace_back(0);
-        q_m.emplace_back(0);
-        q_c.emplace_back(0);
-        q_arith.emplace_back(0);
         break;
     }
     }
@@ -1632,8 +1731,8 @@ template <typename FF> void UltraCircuitBuilder_<FF>::process_non_native_field_m
     for (size_t i = 0; i < cached_partial_non_native_field_multiplications.size(); ++i) {
         auto& c = cached_partial_non_native_field_multiplications[i];
         for (size_t j = 0; j < 5; ++j) {
-            c.a[j] = this->real_variable_index[c.a[j]];
-            c.b[j] = this->real_variable_index[c.b[j]];
+            c.a[j] = this->get_real_variable_index(c.a[j]);
+            c.b[j] = this->get_real_variable_index(c.b[j]);
         }
     }
     std::sort(cached_partial_non_native_field_multiplications.begin(),
@@ -1995,25 +2094,6 @@ template <typename FF> void UltraCircuitBuilder_<FF>::create_ROM_gate(RomRecord&
     ++this->num_gates;
 }
 
-/**
- * @brief Gate that performs consistency checks to validate that a claimed ROM read value is correct
- *
- * @details sorted ROM gates are generated sequentially, each ROM record is sorted by index
- *
- * @param record Stores details of this read operation. Mutated by this fn!
- */
-template <typename FF> void UltraCircuitBuilder_<FF>::create_sorted_ROM_gate(RomRecord& record)
-{
-    record.record_witness = this->add_variable(0);
-    apply_aux_selectors(AUX_SELECTORS::ROM_CONSISTENCY_CHECK);
-    w_l.emplace_back(record.index_witness);
-    w_r.emplace_back(record.value_column1_witness);
-    w_o.emplace_back(record.value_column2_witness);
-    w_4.emplace_back(record.record_witness);
-    record.gate_index = this->num_gates;
-    ++this->num_gates;
-}
-
 /**
  * @brief Create a new read-only memory region
  *
@@ -2059,51 +2139,6 @@ template <typename FF> void UltraCircuitBuilder_<FF>::create_RAM_gate(RamRecord&
     ++this->num_gates;
 }
 
-/**
- * @brief Gate that performs consistency checks to validate that a claimed RAM read/write value is
- * correct
- *
- * @details sorted RAM gates are generated sequentially, each RAM record is sorted first by index then by timestamp
- *
- * @param record Stores details of this read operation. Mutated by this fn!
- */
-template <typename FF> void UltraCircuitBuilder_<FF>::create_sorted_RAM_gate(RamRecord& record)
-{
-    record.record_witness = this->add_variable(0);
-    apply_aux_selectors(AUX_SELECTORS::RAM_CONSISTENCY_CHECK);
-    w_l.emplace_back(record.index_witness);
-    w_r.emplace_back(record.timestamp_witness);
-    w_o.emplace_back(record.value_witness);
-    w_4.emplace_back(record.record_witness);
-    record.gate_index = this->num_gates;
-    ++this->num_gates;
-}
-
-/**
- * @brief Performs consistency checks to validate that a claimed RAM read/write value is correct.
- * Used for the final gate in a list of sorted RAM records
- *
- * @param record Stores details of this read operation. Mutated by this fn!
- */
-template <typename FF>
-void UltraCircuitBuilder_<FF>::create_final_sorted_RAM_gate(RamRecord& record, const size_t ram_array_size)
-{
-    record.record_witness = this->add_variable(0);
-    record.gate_index = this->num_gates;
-
-    create_big_add_gate({
-        record.index_witness,
-        record.timestamp_witness,
-        record.value_witness,
-        record.record_witness,
-        1,
-        0,
-        0,
-        0,
-        -FF((uint64_t)ram_array_size - 1),
-    });
-}
-
 /**
  * @brief Create a new updateable memory region
  *
@@ -2367,245 +2402,266 @@ std::array<uint32_t, 2> UltraCircuitBuilder_<FF>::read_ROM_array_pair(const size
 /**
  * @brief Compute additional gates required to validate ROM reads. Called when generating the proving key
  *
- * @param rom_id The id of the ROM table
- * @param gate_offset_from_public_inputs Required to track the gate position of where we're adding extra gates
+ * @details Sorting an array's records and building its sorted gates depend on no other array, so this reserves the
+ * variables and gates of every array and then fills them in parallel.
  */
-template <typename FF> void UltraCircuitBuilder_<FF>::process_ROM_array(const size_t rom_id)
+template <typename FF> void UltraCircuitBuilder_<FF>::process_ROM_arrays()
 {
-
-    auto& rom_array = rom_arrays[rom_id];
-    const auto read_tag = get_new_tag();        // current_tag + 1;
-    const auto sorted_list_tag = get_new_tag(); // current_tag + 2;
-    create_tag(read_tag, sorted_list_tag);
-    create_tag(sorted_list_tag, read_tag);
-
-    // Make sure that every cell has been initialized
-    for (size_t i = 0; i < rom_array.state.size(); ++i) {
-        if (rom_array.state[i][0] == UNINITIALIZED_MEMORY_RECORD) {
-            set_ROM_element_pair(rom_id, static_cast<uint32_t>(i), { this->zero_idx, this->zero_idx });
+    // Give each array its tags and make sure that each of its cells has been initialized. Initializing adds gates,
+    // so it happens array by array
+    std::vector<std::array<uint32_t, 2>> tags(rom_arrays.size());
+    for (size_t rom_id = 0; rom_id < rom_arrays.size(); ++rom_id) {
+        const auto read_tag = get_new_tag();        // current_tag + 1;
+        const auto sorted_list_tag = get_new_tag(); // current_tag + 2;
+        create_tag(read_tag, sorted_list_tag);
+        create_tag(sorted_list_tag, read_tag);
+        tags[rom_id] = { read_tag, sorted_list_tag };
+
+        auto& rom_array = rom_arrays[rom_id];
+        for (size_t i = 0; i < rom_array.state.size(); ++i) {
+            if (rom_array.state[i][0] == UNINITIALIZED_MEMORY_RECORD) {
+                set_ROM_element_pair(rom_id, static_cast<uint32_t>(i), { this->zero_idx, this->zero_idx });
+            }
         }
     }
 
-#ifdef NO_TBB
-    std::sort(rom_array.records.begin(), rom_array.records.end());
-#else
-    std::sort(std::execution::par_unseq, rom_array.records.begin(), rom_array.records.end());
-#endif
+    // Each record gets a sorted gate with 4 new variables and 2 memory read records. Each array then ends with a
+    // gate and a variable for its maximum index
+    struct ArraySlots {
+        uint32_t first_variable;
+        size_t first_gate;
+        size_t first_read_record;
+    };
+    std::vector<ArraySlots> slots(rom_arrays.size());
+    size_t num_new_variables = 0;
+    size_t num_new_gates = 0;
+    size_t num_new_read_records = 0;
+    for (size_t rom_id = 0; rom_id < rom_arrays.size(); ++rom_id) {
+        const size_t num_records = rom_arrays[rom_id].records.size();
+        slots[rom_id] = { .first_variable = static_cast<uint32_t>(num_new_variables),
+                          .first_gate = num_new_gates,
+                          .first_read_record = num_new_read_records };
+        num_new_variables += 4 * num_records + 1;
+        num_new_gates += num_records + 1;
+        num_new_read_records += 2 * num_records;
+    }
+    const uint32_t first_new_variable = this->add_variables(num_new_variables);
+    const size_t first_new_gate = add_empty_gates(num_new_gates);
+    const size_t first_new_read_record = memory_read_records.size();
+    memory_read_records.resize(first_new_read_record + num_new_read_records);
+
+    parallel_for(rom_arrays.size(), [&](size_t rom_id) {
+        auto& rom_array = rom_arrays[rom_id];
+        const auto [read_tag, sorted_list_tag] = tags[rom_id];
+        // Records that share an index keep their order, so the circuit does not depend on the sort
+        std::stable_sort(rom_array.records.begin(), rom_array.records.end());
+
+        uint32_t variable = first_new_variable + slots[rom_id].first_variable;
+        size_t gate = first_new_gate + slots[rom_id].first_gate;
+        size_t read_record = first_new_read_record + slots[rom_id].first_read_record;
+        for (const RomRecord& record : rom_array.records) {
+            this->variables[variable] = FF((uint64_t)record.index);
+            this->variables[variable + 1] = this->get_variable(record.value_column1_witness);
+            this->variables[variable + 2] = this->get_variable(record.value_column2_witness);
+            // The record witness is computed once eta is known (see create_ROM_gate)
+            for (size_t j = 0; j < 4; ++j) {
+                this->wires[j][gate] = variable + static_cast<uint32_t>(j);
+            }
+            set_aux_selectors(gate, AUX_SELECTORS::ROM_CONSISTENCY_CHECK);
 
-    for (const RomRecord& record : rom_array.records) {
-        const auto index = record.index;
-        const auto value1 = this->get_variable(record.value_column1_witness);
-        const auto value2 = this->get_variable(record.value_column2_witness);
-        const auto index_witness = this->add_variable(FF((uint64_t)index));
-        const auto value1_witness = this->add_variable(value1);
-        const auto value2_witness = this->add_variable(value2);
-        RomRecord sorted_record{
-            .index_witness = index_witness,
-            .value_column1_witness = value1_witness,
-            .value_column2_witness = value2_witness,
-            .index = index,
-            .record_witness = 0,
-            .gate_index = 0,
-        };
-        create_sorted_ROM_gate(sorted_record);
-
-        assign_tag(record.record_witness, read_tag);
-        assign_tag(sorted_record.record_witness, sorted_list_tag);
-
-        // For ROM/RAM gates, the 'record' wire value (wire column 4) is a linear combination of the first 3 wire
-        // values. However...the record value uses the random challenge 'eta', generated after the first 3 wires are
-        // committed to. i.e. we can't compute the record witness here because we don't know what `eta` is! Take the
-        // gate indices of the two rom gates (original read gate + sorted gate) and store in `memory_records`. Once
-        // we
-        // generate the `eta` challenge, we'll use `memory_records` to figure out which gates need a record wire
-        // value
-        // to be computed.
-        // record (w4) = w3 * eta^3 + w2 * eta^2 + w1 * eta + read_write_flag (0 for reads, 1 for writes)
-        // Separate containers used to store gate indices of reads and writes. Need to differentiate because of
-        // `read_write_flag` (N.B. all ROM accesses are considered reads. Writes are for RAM operations)
-        memory_read_records.push_back(static_cast<uint32_t>(sorted_record.gate_index));
-        memory_read_records.push_back(static_cast<uint32_t>(record.gate_index));
-    }
-    // One of the checks we run on the sorted list, is to validate the difference between
-    // the index field across two gates is either 0 or 1.
-    // If we add a dummy gate at the end of the sorted list, where we force the first wire to
-    // equal `m + 1`, where `m` is the maximum allowed index in the sorted list,
-    // we have validated that all ROM reads are correctly constrained
-    FF max_index_value((uint64_t)rom_array.state.size());
-    uint32_t max_index = this->add_variable(max_index_value);
-    create_big_add_gate(
-        {
-            max_index,
-            this->zero_idx,
-            this->zero_idx,
-            this->zero_idx,
-            1,
-            0,
-            0,
-            0,
-            -max_index_value,
-        },
-        false);
-    // N.B. If the above check holds, we know the sorted list begins with an index value of 0,
-    // because the first cell is explicitly initialized using zero_idx as the index field.
+            assign_tag(record.record_witness, read_tag);
+            assign_tag(variable + 3, sorted_list_tag);
+
+            memory_read_records[read_record++] = static_cast<uint32_t>(gate);
+            memory_read_records[read_record++] = static_cast<uint32_t>(record.gate_index);
+            variable += 4;
+            ++gate;
+        }
+        // One of the checks we run on the sorted list, is to validate the difference between
+        // the index field across two gates is either 0 or 1.
+        // If we add a dummy gate at the end of the sorted list, where we force the first wire to
+        // equal `m + 1`, where `m` is the maximum allowed index in the sorted list,
+        // we have validated that all ROM reads are correctly constrained
+        const FF max_index_value((uint64_t)rom_array.state.size());
+        this->variables[variable] = max_index_value;
+        w_l[gate] = variable;
+        q_1[gate] = 1;
+        q_c[gate] = -max_index_value;
+        q_arith[gate] = 1;
+        // N.B. If the above check holds, we know the sorted list begins with an index value of 0,
+        // because the first cell is explicitly initialized using zero_idx as the index field.
+    });
 }
 
 /**
  * @brief Compute additional gates required to validate RAM read/writes. Called when generating the proving key
  *
- * @param ram_id The id of the RAM table
- * @param gate_offset_from_public_inputs Required to track the gate position of where we're adding extra gates
+ * @details As for ROM arrays, the sorted gates of every array are reserved up front and filled in parallel. The range
+ * constraints on the timestamp deltas are added afterwards, in array order, since they can add gates.
  */
-template <typename FF> void UltraCircuitBuilder_<FF>::process_RAM_array(const size_t ram_id)
+template <typename FF> void UltraCircuitBuilder_<FF>::process_RAM_arrays()
 {
-    RamTranscript& ram_array = ram_arrays[ram_id];
-    const auto access_tag = get_new_tag();      // current_tag + 1;
-    const auto sorted_list_tag = get_new_tag(); // current_tag + 2;
-    create_tag(access_tag, sorted_list_tag);
-    create_tag(sorted_list_tag, access_tag);
-
-    // Make sure that every cell has been initialized
+    // Give each array its tags and make sure that each of its cells has been initialized.
     // TODO: throw some kind of error here? Circuit should initialize all RAM elements to prevent errors.
     // e.g. if a RAM record is uninitialized but the index of that record is a function of public/private inputs,
     // different public iputs will produce different circuit constraints.
-    for (size_t i = 0; i < ram_array.state.size(); ++i) {
-        if (ram_array.state[i] == UNINITIALIZED_MEMORY_RECORD) {
-            init_RAM_element(ram_id, static_cast<uint32_t>(i), this->zero_idx);
+    std::vector<std::array<uint32_t, 2>> tags(ram_arrays.size());
+    for (size_t ram_id = 0; ram_id < ram_arrays.size(); ++ram_id) {
+        const auto access_tag = get_new_tag();      // current_tag + 1;
+        const auto sorted_list_tag = get_new_tag(); // current_tag + 2;
+        create_tag(access_tag, sorted_list_tag);
+        create_tag(sorted_list_tag, access_tag);
+        tags[ram_id] = { access_tag, sorted_list_tag };
+
+        RamTranscript& ram_array = ram_arrays[ram_id];
+        for (size_t i = 0; i < ram_array.state.size(); ++i) {
+            if (ram_array.state[i] == UNINITIALIZED_MEMORY_RECORD) {
+                init_RAM_element(ram_id, static_cast<uint32_t>(i), this->zero_idx);
+            }
         }
     }
 
-#ifdef NO_TBB
-    std::sort(ram_array.records.begin(), ram_array.records.end());
-#else
-    std::sort(std::execution::par_unseq, ram_array.records.begin(), ram_array.records.end());
-#endif
-
-    std::vector<RamRecord> sorted_ram_records;
-
-    // Iterate over all but final RAM record.
-    for (size_t i = 0; i < ram_array.records.size(); ++i) {
-        const RamRecord& record = ram_array.records[i];
-
-        const auto index = record.index;
-        const auto value = this->get_variable(record.value_witness);
-        const auto index_witness = this->add_variable(FF((uint64_t)index));
-        const auto timestamp_witess = this->add_variable(record.timestamp);
-        const auto value_witness = this->add_variable(value);
-        RamRecord sorted_record{
-            .index_witness = index_witness,
-            .timestamp_witness = timestamp_witess,
-            .value_witness = value_witness,
-            .index = index,
-            .timestamp = record.timestamp,
-            .access_type = record.access_type,
-            .record_witness = 0,
-            .gate_index = 0,
-        };
-
-        // create a list of sorted ram records
-        sorted_ram_records.emplace_back(sorted_record);
-
-        // We don't apply the RAM consistency check gate to the final record,
-        // as this gate expects a RAM record to be present at the next gate
-        if (i < ram_array.records.size() - 1) {
-            create_sorted_RAM_gate(sorted_record);
-        } else {
-            // For the final record in the sorted list, we do not apply the full consistency check gate.
-            // Only need to check the index value = RAM array size - 1.
-            create_final_sorted_RAM_gate(sorted_record, ram_array.state.size());
-        }
-
-        // Assign record/sorted records to tags that we will perform set equivalence checks on
-        assign_tag(record.record_witness, access_tag);
-        assign_tag(sorted_record.record_witness, sorted_list_tag);
-
-        // For ROM/RAM gates, the 'record' wire value (wire column 4) is a linear combination of the first 3 wire
-        // values. However...the record value uses the random challenge 'eta', generated after the first 3 wires are
-        // committed to. i.e. we can't compute the record witness here because we don't know what `eta` is! Take the
-        // gate indices of the two rom gates (original read gate + sorted gate) and store in `memory_records`. Once
-        // we
-        // generate the `eta` challenge, we'll use `memory_records` to figure out which gates need a record wire
-        // value
-        // to be computed.
-
-        switch (record.access_type) {
-        case RamRecord::AccessType::READ: {
-            memory_read_records.push_back(static_cast<uint32_t>(sorted_record.gate_index));
-            memory_read_records.push_back(static_cast<uint32_t>(record.gate_index));
-            break;
-        }
-        case RamRecord::AccessType::WRITE: {
-            memory_write_records.push_back(static_cast<uint32_t>(sorted_record.gate_index));
-            memory_write_records.push_back(static_cast<uint32_t>(record.gate_index));
-            break;
-        }
-        default: {
-            ASSERT(false); // shouldn't get here!
+    // Each record gets a sorted gate with 4 new variables and 2 memory records. Each adjacent pair of sorted records
+    // then gets a timestamp gate with a variable for the delta, and the list ends with an add gate
+    struct ArraySlots {
+        uint32_t first_variable;
+        size_t first_gate;
+        size_t first_read_record;
+        size_t first_write_record;
+    };
+    std::vector<ArraySlots> slots(ram_arrays.size());
+    size_t num_new_variables = 0;
+    size_t num_new_gates = 0;
+    size_t num_new_read_records = 0;
+    size_t num_new_write_records = 0;
+    for (size_t ram_id = 0; ram_id < ram_arrays.size(); ++ram_id) {
+        const auto& records = ram_arrays[ram_id].records;
+        slots[ram_id] = { .first_variable = static_cast<uint32_t>(num_new_variables),
+                          .first_gate = num_new_gates,
+                          .first_read_record = num_new_read_records,
+                          .first_write_record = num_new_write_records };
+        if (records.empty()) {
+            continue;
         }
+        const auto num_reads = static_cast<size_t>(std::count_if(records.begin(), records.end(), [](const auto& r) {
+            return r.access_type == RamRecord::AccessType::READ;
+        }));
+        num_new_variables += 5 * records.size() - 1;
+        num_new_gates += 2 * records.size();
+        num_new_read_records += 2 * num_reads;
+        num_new_write_records += 2 * (records.size() - num_reads);
+    }
+    const uint32_t first_new_variable = this->add_variables(num_new_variables);
+    const size_t first_new_gate = add_empty_gates(num_new_gates);
+    const size_t first_new_read_record = memory_read_records.size();
+    memory_read_records.resize(first_new_read_record + num_new_read_records);
+    const size_t first_new_write_record = memory_write_records.size();
+    memory_write_records.resize(first_new_write_record + num_new_write_records);
+
+    parallel_for(ram_arrays.size(), [&](size_t ram_id) {
+        RamTranscript& ram_array = ram_arrays[ram_id];
+        if (ram_array.records.empty()) {
+            return;
         }
-    }
-
-    // Step 2: Create gates that validate correctness of RAM timestamps
-
-    std::vector<uint32_t> timestamp_deltas;
-    for (size_t i = 0; i < sorted_ram_records.size() - 1; ++i) {
-        // create_RAM_timestamp_gate(sorted_records[i], sorted_records[i + 1])
-        const auto& current = sorted_ram_records[i];
-        const auto& next = sorted_ram_records[i + 1];
+        const auto [access_tag, sorted_list_tag] = tags[ram_id];
+        // Timestamps are distinct, so the order is total
+        std::sort(ram_array.records.begin(), ram_array.records.end());
+
+        const size_t num_records = ram_array.records.size();
+        const uint32_t first_variable = first_new_variable + slots[ram_id].first_variable;
+        const size_t first_gate = first_new_gate + slots[ram_id].first_gate;
+        size_t read_record = first_new_read_record + slots[ram_id].first_read_record;
+        size_t write_record = first_new_write_record + slots[ram_id].first_write_record;
+        // The sorted record i has variables (index, timestamp, value, record) from first_variable + 4i
+        const auto sorted_variable = [&](size_t i, size_t j) {
+            return first_variable + static_cast<uint32_t>(4 * i + j);
+        };
+        for (size_t i = 0; i < num_records; ++i) {
+            const RamRecord& record = ram_array.records[i];
+            const size_t gate = first_gate + i;
+            this->variables[sorted_variable(i, 0)] = FF((uint64_t)record.index);
+            this->variables[sorted_variable(i, 1)] = FF(record.timestamp);
+            this->variables[sorted_variable(i, 2)] = this->get_variable(record.value_witness);
+            for (size_t j = 0; j < 4; ++j) {
+                this->wires[j][gate] = sorted_variable(i, j);
+            }
+            // We don't apply the RAM consistency check gate to the final record,
+            // as this gate expects a RAM record to be present at the next gate
+            if (i < num_records - 1) {
+                set_aux_selectors(gate, AUX_SELECTORS::RAM_CONSISTENCY_CHECK);
+            } else {
+                // For the final record in the sorted list, we do not apply the full consistency check gate.
+                // Only need to check the index value = RAM array size - 1.
+                q_1[gate] = 1;
+                q_c[gate] = -FF((uint64_t)ram_array.state.size() - 1);
+                q_arith[gate] = 1;
+            }
 
-        const bool share_index = current.index == next.index;
+            // Assign record/sorted records to tags that we will perform set equivalence checks on
+            assign_tag(record.record_witness, access_tag);
+            assign_tag(sorted_variable(i, 3), sorted_list_tag);
 
-        FF timestamp_delta = 0;
-        if (share_index) {
-            ASSERT(next.timestamp > current.timestamp);
-            timestamp_delta = FF(next.timestamp - current.timestamp);
+            // The record wire values use eta, which is only known during proof construction (see create_RAM_gate)
+            switch (record.access_type) {
+            case RamRecord::AccessType::READ: {
+                memory_read_records[read_record++] = static_cast<uint32_t>(gate);
+                memory_read_records[read_record++] = static_cast<uint32_t>(record.gate_index);
+                break;
+            }
+            case RamRecord::AccessType::WRITE: {
+                memory_write_records[write_record++] = static_cast<uint32_t>(gate);
+                memory_write_records[write_record++] = static_cast<uint32_t>(record.gate_index);
+                break;
+            }
+            default: {
+                ASSERT(false); // shouldn't get here!
+            }
+            }
         }
 
-        uint32_t timestamp_delta_witness = this->add_variable(timestamp_delta);
-
-        apply_aux_selectors(AUX_SELECTORS::RAM_TIMESTAMP_CHECK);
-        w_l.emplace_back(current.index_witness);
-        w_r.emplace_back(current.timestamp_witness);
-        w_o.emplace_back(timestamp_delta_witness);
-        w_4.emplace_back(this->zero_idx);
-        ++this->num_gates;
+        // Step 2: Create gates that validate correctness of RAM timestamps
+        const uint32_t first_delta = sorted_variable(num_records, 0);
+        for (size_t i = 0; i < num_records - 1; ++i) {
+            const auto& current = ram_array.records[i];
+            const auto& next = ram_array.records[i + 1];
+            const size_t gate = first_gate + num_records + i;
+
+            FF timestamp_delta = 0;
+            if (current.index == next.index) {
+                ASSERT(next.timestamp > current.timestamp);
+                timestamp_delta = FF(next.timestamp - current.timestamp);
+            }
+            const uint32_t timestamp_delta_witness = first_delta + static_cast<uint32_t>(i);
+            this->variables[timestamp_delta_witness] = timestamp_delta;
 
-        // store timestamp offsets for later. Need to apply range checks to them, but calling
-        // `create_new_range_constraint` can add gates. Would ruin the structure of our sorted timestamp list.
-        timestamp_deltas.push_back(timestamp_delta_witness);
-    }
+            w_l[gate] = sorted_variable(i, 0);
+            w_r[gate] = sorted_variable(i, 1);
+            w_o[gate] = timestamp_delta_witness;
+            set_aux_selectors(gate, AUX_SELECTORS::RAM_TIMESTAMP_CHECK);
+        }
 
-    // add the index/timestamp values of the last sorted record in an empty add gate.
-    // (the previous gate will access the wires on this gate and requires them to be those of the last record)
-    const auto& last = sorted_ram_records[ram_array.records.size() - 1];
-    create_big_add_gate({
-        last.index_witness,
-        last.timestamp_witness,
-        this->zero_idx,
-        this->zero_idx,
-        0,
-        0,
-        0,
-        0,
-        0,
+        // add the index/timestamp values of the last sorted record in an empty add gate.
+        // (the previous gate will access the wires on this gate and requires them to be those of the last record)
+        const size_t last_gate = first_gate + 2 * num_records - 1;
+        w_l[last_gate] = sorted_variable(num_records - 1, 0);
+        w_r[last_gate] = sorted_variable(num_records - 1, 1);
+        q_arith[last_gate] = 1;
     });
-    // Step 3: validate difference in timestamps is monotonically increasing. i.e. is <= maximum timestamp
-    const size_t max_timestamp = ram_array.access_count - 1;
-    for (auto& w : timestamp_deltas) {
-        create_new_range_constraint(w, max_timestamp);
-    }
-}
 
-template <typename FF> void UltraCircuitBuilder_<FF>::process_ROM_arrays()
-{
-    for (size_t i = 0; i < rom_arrays.size(); ++i) {
-        process_ROM_array(i);
-    }
-}
-template <typename FF> void UltraCircuitBuilder_<FF>::process_RAM_arrays()
-{
-    for (size_t i = 0; i < ram_arrays.size(); ++i) {
-        process_RAM_array(i);
+    // Step 3: validate difference in timestamps is monotonically increasing. i.e. is <= maximum timestamp.
+    // `create_new_range_constraint` can add gates, which would ruin the structure of the sorted lists above
+    for (size_t ram_id = 0; ram_id < ram_arrays.size(); ++ram_id) {
+        const RamTranscript& ram_array = ram_arrays[ram_id];
+        if (ram_array.records.empty()) {
+            continue;
+        }
+        const size_t num_records = ram_array.records.size();
+        const uint32_t first_delta =
+            first_new_variable + slots[ram_id].first_variable + static_cast<uint32_t>(4 * num_records);
+        const size_t max_timestamp = ram_array.access_count - 1;
+        for (size_t i = 0; i < num_records - 1; ++i) {
+            create_new_range_constraint(first_delta + static_cast<uint32_t>(i), max_timestamp);
+        }
     }
 }
 
@@ -3186,22 +3242,23 @@ inline FF UltraCircuitBuilder_<FF>::compute_auxilary_identity(FF q_aux_value,
 }
 
 /**
- * @brief Check that the circuit is correct in its current state
+ * @brief Check the gates [start, end) of the circuit, splitting them between threads
  *
- * @details The method switches the circuit to the "in-the-head" version, finalizes it, checks gates, lookups and
- * permutations and then switches it back from the in-the-head version, discarding the updates
+ * @details The gates are checked in place: the identities are evaluated on the builder's own wires and selectors.
+ * Each thread checks a contiguous range of gates and stops at its first failure, or once another thread has failed at
+ * an earlier gate, so the failure returned is the first in the range whatever the number of threads. The last gate of
+ * the circuit is checked with its shifted wires set to zero.
  *
- * @return true
- * @return false
+ * @param check_tags Whether to also check the tag permutation, which covers the whole circuit, so only makes sense for
+ * start = 0 and end = num_gates
  */
-template <typename FF> bool UltraCircuitBuilder_<FF>::check_circuit()
+template <typename FF>
+std::optional<typename UltraCircuitBuilder_<FF>::CircuitCheckFailure> UltraCircuitBuilder_<FF>::check_gates(
+    const size_t start, const size_t end, const bool check_tags) const
 {
-    bool result = true;
-    CircuitDataBackup circuit_backup = CircuitDataBackup::store_prefinilized_state(this);
-    // Finalize circuit-in-the-head
-
-    finalize_circuit();
-
+    if (start >= end) {
+        return std::nullopt;
+    }
     // Sample randomness
     const FF arithmetic_base = FF::random_element();
     const FF elliptic_base = FF::random_element();
@@ -3210,15 +3267,41 @@ template <typename FF> bool UltraCircuitBuilder_<FF>::check_circuit()
     const FF alpha = FF::random_element();
     const FF eta = FF::random_element();
 
-    // We need to get all memory
-    std::unordered_set<size_t> memory_read_record_gates;
-    std::unordered_set<size_t> memory_write_record_gates;
-    for (const auto& gate_idx : memory_read_records) {
-        memory_read_record_gates.insert(gate_idx);
+    // The memory records of gates [start, end], whose 4th wire holds a value computed from eta by the prover. The
+    // records of the ROM and RAM transcripts are those of the gates created before the circuit is finalized.
+    enum MemoryRecord : uint8_t { NONE, READ, WRITE };
+    std::vector<MemoryRecord> memory_records(end + 1 - start, NONE);
+    auto set_memory_record = [&](const size_t gate_index, const MemoryRecord record) {
+        if (gate_index >= start && gate_index <= end) {
+            memory_records[gate_index - start] = record;
+        }
+    };
+    for (const auto& gate_index : memory_read_records) {
+        set_memory_record(gate_index, READ);
     }
-    for (const auto& gate_idx : memory_write_records) {
-        memory_write_record_gates.insert(gate_idx);
+    for (const auto& gate_index : memory_write_records) {
+        set_memory_record(gate_index, WRITE);
     }
+    for (const auto& rom_array : rom_arrays) {
+        for (const auto& record : rom_array.records) {
+            set_memory_record(record.gate_index, READ);
+        }
+    }
+    for (const auto& ram_array : ram_arrays) {
+        for (const auto& record : ram_array.records) {
+            set_memory_record(record.gate_index, record.access_type == RamRecord::AccessType::READ ? READ : WRITE);
+        }
+    }
+    auto memory_record_value = [&](const size_t gate_index, const FF& w_1, const FF& w_2, const FF& w_3, const FF& w_4) {
+        switch (memory_records[gate_index - start]) {
+        case READ:
+            return ((w_3 * eta + w_2) * eta + w_1) * eta;
+        case WRITE:
+            return ((w_3 * eta + w_2) * eta + w_1) * eta + FF::one();
+        default:
+            return w_4;
+        }
+    };
 
     // A hashing implementation for quick simulation lookups
     struct HashFrTuple {
@@ -3243,10 +3326,18 @@ template <typename FF> bool UltraCircuitBuilder_<FF>::check_circuit()
             return entry1 == entry2;
         }
     };
-    // The set of all lookup tuples that are in the tables
+    // The lookup tuples of the tables which the lookup gates in the range use. The set is only read by the threads.
+    std::unordered_set<uint64_t> used_table_indices;
+    for (size_t i = start; i < end; ++i) {
+        if (!q_lookup_type[i].is_zero()) {
+            used_table_indices.insert(uint256_t(q_3[i]).data[0]);
+        }
+    }
     std::unordered_set<std::tuple<FF, FF, FF, FF>, HashFrTuple, EqualFrTuple> table_hash;
-    // Prepare the lookup set for use in the circuit
     for (auto& table : lookup_tables) {
+        if (!used_table_indices.contains(table.table_index)) {
+            continue;
+        }
         const FF table_index(table.table_index);
         for (size_t i = 0; i < table.size; ++i) {
             const auto components =
@@ -3255,110 +3346,32 @@ template <typename FF> bool UltraCircuitBuilder_<FF>::check_circuit()
         }
     }
 
-    // We use a running tag product mechanism to ensure tag correctness
-    // This is the product of (value + γ ⋅ tag)
-    FF left_tag_product = FF::one();
-    // This is the product of (value + γ ⋅ tau[tag])
-    FF right_tag_product = FF::one();
-    // Randomness for the tag check
-    const FF tag_gamma = FF::random_element();
-    // We need to include each variable only once
-    std::unordered_set<size_t> encountered_variables;
-
-    // Function to quickly update tag products and encountered variable set by index and value
-    auto update_tag_check_information = [&](size_t variable_index, FF value) {
-        size_t real_index = this->real_variable_index[variable_index];
-        // Check to ensure that we are not including a variable twice
-        if (encountered_variables.contains(real_index)) {
-            return;
-        }
-        size_t tag_in = this->real_variable_tags[real_index];
-        if (tag_in != DUMMY_TAG) {
-            size_t tag_out = this->tau.at((uint32_t)tag_in);
-            left_tag_product *= value + tag_gamma * FF(tag_in);
-            right_tag_product *= value + tag_gamma * FF(tag_out);
-            encountered_variables.insert(real_index);
-        }
-    };
-    // For each gate
-    for (size_t i = 0; i < this->num_gates; i++) {
-        FF q_arith_value;
-        FF q_aux_value;
-        FF q_elliptic_value;
-        FF q_sort_value;
-        FF q_lookup_type_value;
-        FF q_1_value;
-        FF q_2_value;
-        FF q_3_value;
-        FF q_4_value;
-        FF q_m_value;
-        FF q_c_value;
-        FF w_1_value;
-        FF w_2_value;
-        FF w_3_value;
-        FF w_4_value;
-        FF w_4_index;
-        // Get the values of selectors and wires and update tag products along the way
-        q_arith_value = q_arith[i];
-        q_aux_value = q_aux[i];
-        q_elliptic_value = q_elliptic[i];
-        q_sort_value = q_sort[i];
-        q_lookup_type_value = q_lookup_type[i];
-        q_1_value = q_1[i];
-        q_2_value = q_2[i];
-        q_3_value = q_3[i];
-        q_4_value = q_4[i];
-        q_m_value = q_m[i];
-        q_c_value = q_c[i];
-        w_1_value = this->get_variable(w_l[i]);
-        update_tag_check_information(w_l[i], w_1_value);
-        w_2_value = this->get_variable(w_r[i]);
-        update_tag_check_information(w_r[i], w_2_value);
-        w_3_value = this->get_variable(w_o[i]);
-        update_tag_check_information(w_o[i], w_3_value);
-        w_4_value = this->get_variable(w_4[i]);
-        // We need to wait before updating tag product for w_4
-        w_4_index = w_4[i];
-
-        // If we are touching a gate with memory access, we need to update the value of the 4th witness
-        if (memory_read_record_gates.contains(i)) {
-            w_4_value = ((w_3_value * eta + w_2_value) * eta + w_1_value) * eta;
-        }
-        if (memory_write_record_gates.contains(i)) {
-            w_4_value = ((w_3_value * eta + w_2_value) * eta + w_1_value) * eta + FF::one();
-        }
-        // Now we can update the tag product for w_4
-        update_tag_check_information((uint32_t)w_4_index, w_4_value);
-        FF w_1_shifted_value;
-        FF w_2_shifted_value;
-        FF w_3_shifted_value;
-        FF w_4_shifted_value;
+    // Returns the name of the first identity which fails at the gate, if any
+    auto check_gate = [&](const size_t i) -> std::optional<std::string_view> {
+        const FF w_1_value = this->get_variable(w_l[i]);
+        const FF w_2_value = this->get_variable(w_r[i]);
+        const FF w_3_value = this->get_variable(w_o[i]);
+        const FF w_4_value = memory_record_value(i, w_1_value, w_2_value, w_3_value, this->get_variable(w_4[i]));
+        FF w_1_shifted_value = FF::zero();
+        FF w_2_shifted_value = FF::zero();
+        FF w_3_shifted_value = FF::zero();
+        FF w_4_shifted_value = FF::zero();
         if (i < (this->num_gates - 1)) {
-
             w_1_shifted_value = this->get_variable(w_l[i + 1]);
             w_2_shifted_value = this->get_variable(w_r[i + 1]);
             w_3_shifted_value = this->get_variable(w_o[i + 1]);
             w_4_shifted_value = this->get_variable(w_4[i + 1]);
-        } else {
-            w_1_shifted_value = FF::zero();
-            w_2_shifted_value = FF::zero();
-            w_3_shifted_value = FF::zero();
-            w_4_shifted_value = FF::zero();
-        }
-        if (memory_read_record_gates.contains(i + 1)) {
-            w_4_shifted_value = ((w_3_shifted_value * eta + w_2_shifted_value) * eta + w_1_shifted_value) * eta;
         }
-        if (memory_write_record_gates.contains(i + 1)) {
-            w_4_shifted_value =
-                ((w_3_shifted_value * eta + w_2_shifted_value) * eta + w_1_shifted_value) * eta + FF::one();
-        }
-        if (!compute_arithmetic_identity(q_arith_value,
-                                         q_1_value,
-                                         q_2_value,
-                                         q_3_value,
-                                         q_4_value,
-                                         q_m_value,
-                                         q_c_value,
+        w_4_shifted_value =
+            memory_record_value(i + 1, w_1_shifted_value, w_2_shifted_value, w_3_shifted_value, w_4_shifted_value);
+
+        if (!compute_arithmetic_identity(q_arith[i],
+                                         q_1[i],
+                                         q_2[i],
+                                         q_3[i],
+                                         q_4[i],
+                                         q_m[i],
+                                         q_c[i],
                                          w_1_value,
                                          w_2_value,
                                          w_3_value,
@@ -3368,20 +3381,16 @@ template <typename FF> bool UltraCircuitBuilder_<FF>::check_circuit()
                                          arithmetic_base,
                                          alpha)
                  .is_zero()) {
-#ifndef FUZZING
-            info("Arithemtic identity fails at gate ", i);
-#endif
-            result = false;
-            break;
+            return "arithmetic";
         }
-        if (!compute_auxilary_identity(q_aux_value,
-                                       q_arith_value,
-                                       q_1_value,
-                                       q_2_value,
-                                       q_3_value,
-                                       q_4_value,
-                                       q_m_value,
-                                       q_c_value,
+        if (!compute_auxilary_identity(q_aux[i],
+                                       q_arith[i],
+                                       q_1[i],
+                                       q_2[i],
+                                       q_3[i],
+                                       q_4[i],
+                                       q_m[i],
+                                       q_c[i],
                                        w_1_value,
                                        w_2_value,
                                        w_3_value,
@@ -3394,16 +3403,11 @@ template <typename FF> bool UltraCircuitBuilder_<FF>::check_circuit()
                                        alpha,
                                        eta)
                  .is_zero()) {
-#ifndef FUZZING
-            info("Auxilary identity fails at gate ", i);
-#endif
-
-            result = false;
-            break;
+            return "auxiliary";
         }
-        if (!compute_elliptic_identity(q_elliptic_value,
-                                       q_1_value,
-                                       q_m_value,
+        if (!compute_elliptic_identity(q_elliptic[i],
+                                       q_1[i],
+                                       q_m[i],
                                        w_2_value,
                                        w_3_value,
                                        w_1_shifted_value,
@@ -3413,47 +3417,163 @@ template <typename FF> bool UltraCircuitBuilder_<FF>::check_circuit()
                                        elliptic_base,
                                        alpha)
                  .is_zero()) {
-#ifndef FUZZING
-            info("Elliptic identity fails at gate ", i);
-#endif
-            result = false;
-            break;
+            return "elliptic";
         }
         if (!compute_genperm_sort_identity(
-                 q_sort_value, w_1_value, w_2_value, w_3_value, w_4_value, w_1_shifted_value, genperm_sort_base, alpha)
+                 q_sort[i], w_1_value, w_2_value, w_3_value, w_4_value, w_1_shifted_value, genperm_sort_base, alpha)
                  .is_zero()) {
-#ifndef FUZZING
-            info("Genperm sort identity fails at gate ", i);
-#endif
+            return "genperm sort";
+        }
+        if (!q_lookup_type[i].is_zero()) {
+            if (!table_hash.contains(std::make_tuple(w_1_value + q_2[i] * w_1_shifted_value,
+                                                     w_2_value + q_m[i] * w_2_shifted_value,
+                                                     w_3_value + q_c[i] * w_3_shifted_value,
+                                                     q_3[i]))) {
+                return "lookup";
+            }
+        }
+        return std::nullopt;
+    };
 
-            result = false;
+    // Below this many gates per thread, the threads cost more than they save
+    constexpr size_t MIN_GATES_PER_THREAD = 1024;
+    const size_t num_gates_to_check = end - start;
+    const size_t num_threads = std::clamp(num_gates_to_check / MIN_GATES_PER_THREAD, size_t(1), get_num_cpus());
+    std::atomic<size_t> first_failing_gate = end;
+    std::vector<std::optional<CircuitCheckFailure>> thread_failures(num_threads);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t thread_start = start + (thread_idx * num_gates_to_check) / num_threads;
+        const size_t thread_end = start + ((thread_idx + 1) * num_gates_to_check) / num_threads;
+        for (size_t i = thread_start; i < thread_end && i < first_failing_gate.load(std::memory_order_relaxed); ++i) {
+            const auto failed_check = check_gate(i);
+            if (!failed_check) {
+                continue;
+            }
+            thread_failures[thread_idx] = CircuitCheckFailure{
+                .check = *failed_check,
+                .gate_index = i,
+                .wire_values = { this->get_variable(w_l[i]),
+                                 this->get_variable(w_r[i]),
+                                 this->get_variable(w_o[i]),
+                                 this->get_variable(w_4[i]) },
+            };
+            size_t current = first_failing_gate.load();
+            while (i < current && !first_failing_gate.compare_exchange_weak(current, i)) {
+            }
             break;
         }
-        if (!q_lookup_type_value.is_zero()) {
-            if (!table_hash.contains(std::make_tuple(w_1_value + q_2_value * w_1_shifted_value,
-                                                     w_2_value + q_m_value * w_2_shifted_value,
-                                                     w_3_value + q_c_value * w_3_shifted_value,
-                                                     q_3_value))) {
-#ifndef FUZZING
-                info("Lookup fails at gate ", i);
-#endif
+    });
+    // The threads hold their failures in gate order, so the first is the earliest
+    for (auto& failure : thread_failures) {
+        if (failure) {
+            return failure;
+        }
+    }
+    if (!check_tags) {
+        return std::nullopt;
+    }
 
-                result = false;
-                break;
-            }
+    // We use a running tag product mechanism to ensure tag correctness
+    // This is the product of (value + γ ⋅ tag)
+    FF left_tag_product = FF::one();
+    // This is the product of (value + γ ⋅ tau[tag])
+    FF right_tag_product = FF::one();
+    // Randomness for the tag check
+    const FF tag_gamma = FF::random_element();
+    // We need to include each variable only once
+    std::vector<bool> encountered_variables(this->variables.size(), false);
+
+    // Function to quickly update tag products and encountered variable set by index and value
+    auto update_tag_check_information = [&](uint32_t variable_index, FF value) {
+        size_t real_index = this->get_real_variable_index(variable_index);
+        // Check to ensure that we are not including a variable twice
+        if (encountered_variables[real_index]) {
+            return;
+        }
+        size_t tag_in = this->real_variable_tags[real_index];
+        if (tag_in != DUMMY_TAG) {
+            size_t tag_out = this->tau.at((uint32_t)tag_in);
+            left_tag_product *= value + tag_gamma * FF(tag_in);
+            right_tag_product *= value + tag_gamma * FF(tag_out);
+            encountered_variables[real_index] = true;
         }
+    };
+    for (size_t i = start; i < end; ++i) {
+        const FF w_1_value = this->get_variable(w_l[i]);
+        const FF w_2_value = this->get_variable(w_r[i]);
+        const FF w_3_value = this->get_variable(w_o[i]);
+        update_tag_check_information(w_l[i], w_1_value);
+        update_tag_check_information(w_r[i], w_2_value);
+        update_tag_check_information(w_o[i], w_3_value);
+        update_tag_check_information(
+            w_4[i], memory_record_value(i, w_1_value, w_2_value, w_3_value, this->get_variable(w_4[i])));
     }
     if (left_tag_product != right_tag_product) {
+        return CircuitCheckFailure{ .check = "tag permutation", .gate_index = std::nullopt, .wire_values = {} };
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief Check that the circuit is correct in its current state, returning the first check which fails, if any
+ *
+ * @details An unfinalized circuit lacks its ROM, RAM and range gates, so the method finalizes the "in-the-head"
+ * version of the circuit, checks gates, lookups and permutations and then switches it back from the in-the-head
+ * version, discarding the updates. A finalized circuit is checked as it is, without backing up its state.
+ */
+template <typename FF>
+std::optional<typename UltraCircuitBuilder_<FF>::CircuitCheckFailure> UltraCircuitBuilder_<FF>::find_circuit_failure()
+{
+    if (circuit_finalised) {
+        return check_gates(0, this->num_gates, /*check_tags=*/true);
+    }
+    CircuitDataBackup circuit_backup = CircuitDataBackup::store_prefinilized_state(this);
+    // Finalize circuit-in-the-head
+    finalize_circuit();
+    auto failure = check_gates(0, this->num_gates, /*check_tags=*/true);
+    circuit_backup.restore_prefinilized_state(this);
+    return failure;
+}
+
+/**
+ * @brief Check that the circuit is correct in its current state
+ *
+ * @return true
+ * @return false
+ */
+template <typename FF> bool UltraCircuitBuilder_<FF>::check_circuit()
+{
+    const auto failure = find_circuit_failure();
 #ifndef FUZZING
-        if (result) {
-            info("Tag permutation failed");
-        }
+    if (failure && failure->gate_index) {
+        info("Circuit check \"", failure->check, "\" fails at gate ", *failure->gate_index);
+    } else if (failure) {
+        info("Circuit check \"", failure->check, "\" fails");
+    }
 #endif
+    return !failure.has_value();
+}
 
-        result = false;
+/**
+ * @brief Check the gates added since the last call, without finalizing the circuit
+ *
+ * @details This is cheap enough to call as the circuit is built, to find the first bad gate soon after it is added.
+ * It checks the identities and lookups of each gate, but not the copy constraints, tags, or the ROM, RAM and range
+ * gates which only finalization adds: check_circuit checks those. Until the circuit is finalized the shifted wires of
+ * the last gate are those of a gate which doesn't exist yet, so that gate waits for the next call.
+ */
+template <typename FF>
+std::optional<typename UltraCircuitBuilder_<FF>::CircuitCheckFailure> UltraCircuitBuilder_<FF>::check_new_gates()
+{
+    const size_t end = circuit_finalised ? this->num_gates : std::max(this->num_gates, size_t(1)) - 1;
+    if (num_gates_checked >= end) {
+        return std::nullopt;
     }
-    circuit_backup.restore_prefinilized_state(this);
-    return result;
+    auto failure = check_gates(num_gates_checked, end, /*check_tags=*/false);
+    if (!failure) {
+        num_gates_checked = end;
+    }
+    return failure;
 }
 template class UltraCircuitBuilder_<barretenberg::fr>;
 // To enable this we need to template plookup
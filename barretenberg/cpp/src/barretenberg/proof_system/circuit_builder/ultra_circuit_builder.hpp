@@ -11,6 +11,7 @@
 #include "barretenberg/proof_system/types/pedersen_commitment_type.hpp"
 #include "circuit_builder_base.hpp"
 #include <optional>
+#include <string_view>
 
 namespace proof_system {
 
@@ -236,17 +237,16 @@ template <typename FF> class UltraCircuitBuilder_ : public CircuitBuilderBase<ar
      * restore the circuit to the state before the finalization.
      */
     struct CircuitDataBackup {
-        using WireVector = std::vector<uint32_t, barretenberg::ContainerSlabAllocator<uint32_t>>;
-        using SelectorVector = std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>;
+        using WireVector = barretenberg::BlockVector<uint32_t>;
+        using SelectorVector = barretenberg::BlockVector<FF>;
 
         std::vector<uint32_t> public_inputs;
         std::vector<FF> variables;
-        // index of next variable in equivalence class (=REAL_VARIABLE if you're last)
+        // the union-find forest of the equivalence classes of variables (see CircuitBuilderBase)
+        std::vector<uint32_t> parent_var_index;
+        std::vector<uint8_t> var_class_rank;
         std::vector<uint32_t> next_var_index;
-        // index of  previous variable in equivalence class (=FIRST if you're in a cycle alone)
-        std::vector<uint32_t> prev_var_index;
-        // indices of corresponding real variables
-        std::vector<uint32_t> real_variable_index;
+        std::vector<uint32_t> class_real_variable_index;
         std::vector<uint32_t> real_variable_tags;
         std::map<FF, uint32_t> constant_variable_indices;
         WireVector w_l;
@@ -294,11 +294,10 @@ template <typename FF> class UltraCircuitBuilder_ : public CircuitBuilderBase<ar
             stored_state.public_inputs = builder.public_inputs;
             stored_state.variables = builder.variables;
 
+            stored_state.parent_var_index = builder.parent_var_index;
+            stored_state.var_class_rank = builder.var_class_rank;
             stored_state.next_var_index = builder.next_var_index;
-
-            stored_state.prev_var_index = builder.prev_var_index;
-
-            stored_state.real_variable_index = builder.real_variable_index;
+            stored_state.class_real_variable_index = builder.class_real_variable_index;
             stored_state.real_variable_tags = builder.real_variable_tags;
             stored_state.constant_variable_indices = builder.constant_variable_indices;
             stored_state.w_l = builder.w_l;
@@ -346,11 +345,10 @@ template <typename FF> class UltraCircuitBuilder_ : public CircuitBuilderBase<ar
             stored_state.public_inputs = builder->public_inputs;
             stored_state.variables = builder->variables;
 
+            stored_state.parent_var_index = builder->parent_var_index;
+            stored_state.var_class_rank = builder->var_class_rank;
             stored_state.next_var_index = builder->next_var_index;
-
-            stored_state.prev_var_index = builder->prev_var_index;
-
-            stored_state.real_variable_index = builder->real_variable_index;
+            stored_state.class_real_variable_index = builder->class_real_variable_index;
             stored_state.real_variable_tags = builder->real_variable_tags;
             stored_state.constant_variable_indices = builder->constant_variable_indices;
             stored_state.current_tag = builder->current_tag;
@@ -381,11 +379,10 @@ template <typename FF> class UltraCircuitBuilder_ : public CircuitBuilderBase<ar
             builder->public_inputs = public_inputs;
             builder->variables = variables;
 
+            builder->parent_var_index = parent_var_index;
+            builder->var_class_rank = var_class_rank;
             builder->next_var_index = next_var_index;
-
-            builder->prev_var_index = prev_var_index;
-
-            builder->real_variable_index = real_variable_index;
+            builder->class_real_variable_index = class_real_variable_index;
             builder->real_variable_tags = real_variable_tags;
             builder->constant_variable_indices = constant_variable_indices;
             builder->current_tag = current_tag;
@@ -431,13 +428,16 @@ template <typename FF> class UltraCircuitBuilder_ : public CircuitBuilderBase<ar
             if (!(variables == builder.variables)) {
                 return false;
             }
-            if (!(next_var_index == builder.next_var_index)) {
+            if (!(parent_var_index == builder.parent_var_index)) {
                 return false;
             }
-            if (!(prev_var_index == builder.prev_var_index)) {
+            if (!(var_class_rank == builder.var_class_rank)) {
+                return false;
+            }
+            if (!(next_var_index == builder.next_var_index)) {
                 return false;
             }
-            if (!(real_variable_index == builder.real_variable_index)) {
+            if (!(class_real_variable_index == builder.class_real_variable_index)) {
                 return false;
             }
             if (!(real_variable_tags == builder.real_variable_tags)) {
@@ -526,8 +526,8 @@ template <typename FF> class UltraCircuitBuilder_ : public CircuitBuilderBase<ar
         }
     };
 
-    using WireVector = std::vector<uint32_t, ContainerSlabAllocator<uint32_t>>;
-    using SelectorVector = std::vector<FF, ContainerSlabAllocator<FF>>;
+    using WireVector = BlockVector<uint32_t>;
+    using SelectorVector = BlockVector<FF>;
 
     WireVector& w_l = std::get<0>(this->wires);
     WireVector& w_r = std::get<1>(this->wires);
@@ -607,6 +607,7 @@ template <typename FF> class UltraCircuitBuilder_ : public CircuitBuilderBase<ar
         memory_write_records = other.memory_write_records;
         cached_partial_non_native_field_multiplications = other.cached_partial_non_native_field_multiplications;
         circuit_finalised = other.circuit_finalised;
+        num_gates_checked = other.num_gates_checked;
     };
     UltraCircuitBuilder_& operator=(const UltraCircuitBuilder_& other) = delete;
     UltraCircuitBuilder_& operator=(UltraCircuitBuilder_&& other)
@@ -623,6 +624,7 @@ template <typename FF> class UltraCircuitBuilder_ : public CircuitBuilderBase<ar
         memory_write_records = other.memory_write_records;
         cached_partial_non_native_field_multiplications = other.cached_partial_non_native_field_multiplications;
         circuit_finalised = other.circuit_finalised;
+        num_gates_checked = other.num_gates_checked;
         return *this;
     };
     ~UltraCircuitBuilder_() override = default;
@@ -898,11 +900,11 @@ template <typename FF> class UltraCircuitBuilder_ : public CircuitBuilderBase<ar
     {
         ASSERT(tag <= this->current_tag);
         // If we've already assigned this tag to this variable, return (can happen due to copy constraints)
-        if (this->real_variable_tags[this->real_variable_index[variable_index]] == tag) {
+        if (this->real_variable_tags[this->get_real_variable_index(variable_index)] == tag) {
             return;
         }
-        ASSERT(this->real_variable_tags[this->real_variable_index[variable_index]] == DUMMY_TAG);
-        this->real_variable_tags[this->real_variable_index[variable_index]] = tag;
+        ASSERT(this->real_variable_tags[this->get_real_variable_index(variable_index)] == DUMMY_TAG);
+        this->real_variable_tags[this->get_real_variable_index(variable_index)] = tag;
     }
 
     uint32_t create_tag(const uint32_t tag_index, const uint32_t tau_index)
@@ -919,13 +921,21 @@ template <typename FF> class UltraCircuitBuilder_ : public CircuitBuilderBase<ar
     }
 
     RangeList create_range_list(const uint64_t target_range);
-    void process_range_list(RangeList& list);
+    std::vector<uint32_t> sort_range_list(RangeList& list, const std::vector<uint32_t>& real_variable_index);
     void process_range_lists();
 
+    /**
+     * @brief Append gates whose wires are all zero_idx and whose selectors are all zero, to be filled in place
+     *
+     * @return size_t The index of the first new gate
+     */
+    size_t add_empty_gates(const size_t num_new_gates);
+
     /**
      * Custom Gate Selectors
      **/
     void apply_aux_selectors(const AUX_SELECTORS type);
+    void set_aux_selectors(const size_t gate_index, const AUX_SELECTORS type);
 
     /**
      * Non Native Field Arithmetic
@@ -966,19 +976,14 @@ template <typename FF> class UltraCircuitBuilder_ : public CircuitBuilderBase<ar
     uint32_t read_ROM_array(const size_t rom_id, const uint32_t index_witness);
     std::array<uint32_t, 2> read_ROM_array_pair(const size_t rom_id, const uint32_t index_witness);
     void create_ROM_gate(RomRecord& record);
-    void create_sorted_ROM_gate(RomRecord& record);
-    void process_ROM_array(const size_t rom_id);
     void process_ROM_arrays();
 
     void create_RAM_gate(RamRecord& record);
-    void create_sorted_RAM_gate(RamRecord& record);
-    void create_final_sorted_RAM_gate(RamRecord& record, const size_t ram_array_size);
 
     size_t create_RAM_array(const size_t array_size);
     void init_RAM_element(const size_t ram_id, const size_t index_value, const uint32_t value_witness);
     uint32_t read_RAM_array(const size_t ram_id, const uint32_t index_witness);
     void write_RAM_array(const size_t ram_id, const uint32_t index_witness, const uint32_t value_witness);
-    void process_RAM_array(const size_t ram_id);
     void process_RAM_arrays();
 
     // Circuit evaluation methods
@@ -1037,7 +1042,25 @@ template <typename FF> class UltraCircuitBuilder_ : public CircuitBuilderBase<ar
                                      FF alpha_base,
                                      FF alpha) const;
 
+    /**
+     * @brief A failed check of the circuit: which check failed and, for the checks of the gates, the first gate at
+     * which it failed and the values of that gate's wires.
+     */
+    struct CircuitCheckFailure {
+        // "arithmetic", "auxiliary", "elliptic", "genperm sort", "lookup" or "tag permutation"
+        std::string_view check;
+        // Unset for the tag permutation check, which doesn't fail at any one gate
+        std::optional<size_t> gate_index;
+        std::array<FF, 4> wire_values{};
+    };
+
     bool check_circuit();
+    std::optional<CircuitCheckFailure> find_circuit_failure();
+    std::optional<CircuitCheckFailure> check_new_gates();
+    std::optional<CircuitCheckFailure> check_gates(size_t start, size_t end, bool check_tags) const;
+
+    // The gates before this one have passed check_new_gates
+    size_t num_gates_checked = 0;
 };
 extern template class UltraCircuitBuilder_<barretenberg::fr>;
 // TODO: template plookup to be able to be able to have UltraCircuitBuilder on Grumpkin
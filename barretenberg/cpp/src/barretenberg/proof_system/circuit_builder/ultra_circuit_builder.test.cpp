@@ -98,6 +98,85 @@ TEST(ultra_circuit_constructor, create_gates_from_plookup_accumulators)
     EXPECT_EQ(result, true);
     EXPECT_TRUE(saved_state.is_same_state(circuit_constructor));
 }
+TEST(ultra_circuit_constructor, lookup_tables_are_shared)
+{
+    auto add_xor = [](UltraCircuitBuilder& builder, const uint64_t left, const uint64_t right) {
+        const auto left_index = builder.add_variable(left);
+        const auto right_index = builder.add_variable(right);
+        const auto sequence_data = plookup::get_lookup_accumulators(MultiTableId::UINT32_XOR, left, right, true);
+        return builder.create_gates_from_plookup_accumulators(
+            MultiTableId::UINT32_XOR, sequence_data, left_index, right_index);
+    };
+    UltraCircuitBuilder first_builder = UltraCircuitBuilder();
+    UltraCircuitBuilder second_builder = UltraCircuitBuilder();
+    const auto first_xor = add_xor(first_builder, 0xdeadbeef, 0x12345678);
+    // Give the tables different indices in the second circuit, by adding another table first
+    second_builder.get_table(plookup::BasicTableId::AES_SBOX_MAP);
+    const auto second_xor = add_xor(second_builder, 0xcafebabe, 0x0f0f0f0f);
+
+    EXPECT_EQ(first_builder.get_variable(first_xor[ColumnIdx::C3][0]), fr(0xdeadbeef ^ 0x12345678));
+    EXPECT_EQ(second_builder.get_variable(second_xor[ColumnIdx::C3][0]), fr(0xcafebabe ^ 0x0f0f0f0f));
+    for (const auto& first_table : first_builder.lookup_tables) {
+        const auto& second_table = second_builder.get_table(first_table.id);
+        // The columns are the registry's, while the table's index and lookups belong to each circuit
+        EXPECT_EQ(first_table.column_1.data(), plookup::get_shared_basic_table(first_table.id).column_1.data());
+        EXPECT_EQ(first_table.column_1.data(), second_table.column_1.data());
+        EXPECT_EQ(first_table.column_3.data(), second_table.column_3.data());
+        EXPECT_NE(first_table.table_index, second_table.table_index);
+        EXPECT_EQ(first_table.lookup_gates.size(), second_table.lookup_gates.size());
+        EXPECT_NE(first_table.lookup_gates[0], second_table.lookup_gates[0]);
+    }
+    EXPECT_TRUE(first_builder.check_circuit());
+    EXPECT_TRUE(second_builder.check_circuit());
+}
+
+TEST(ultra_circuit_constructor, lookup_gates_record_table_rows)
+{
+    UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
+    // Tables keyed in order, with twin keys and with one key, and tables keyed by sparse-form values
+    const std::vector<std::pair<MultiTableId, bool>> multi_tables{ { MultiTableId::UINT32_XOR, true },
+                                                                   { MultiTableId::PEDERSEN_LEFT_LO, false },
+                                                                   { MultiTableId::SHA256_CH_OUTPUT, false } };
+    for (const auto& [id, is_2_to_1_lookup] : multi_tables) {
+        const fr key_a = id == MultiTableId::SHA256_CH_OUTPUT
+                             ? fr(numeric::map_into_sparse_form<28>(0x12345678))
+                             : fr(uint256_t(fr::random_element(&engine)).slice(0, 32));
+        const fr key_b = is_2_to_1_lookup ? fr(0x0f0f0f0f) : fr(0);
+        const auto read_values = plookup::get_lookup_accumulators(id, key_a, key_b, is_2_to_1_lookup);
+        const auto key_a_index = circuit_constructor.add_variable(key_a);
+        if (is_2_to_1_lookup) {
+            circuit_constructor.create_gates_from_plookup_accumulators(
+                id, read_values, key_a_index, circuit_constructor.add_variable(key_b));
+        } else {
+            circuit_constructor.create_gates_from_plookup_accumulators(id, read_values, key_a_index);
+        }
+
+        // Each lookup records the row of its table that holds its key and values
+        const auto& multi_table = plookup::create_table(id);
+        for (size_t i = 0; i < read_values.key_entries.size(); ++i) {
+            const auto& table = circuit_constructor.get_table(multi_table.lookup_ids[i]);
+            const auto& entry = read_values.key_entries[i];
+            const auto components = entry.to_sorted_list_components(table.use_twin_keys);
+            const auto row = table.row_index.find(entry.key);
+            ASSERT_TRUE(row.has_value());
+            EXPECT_EQ(table.column_1[*row], components[0]);
+            EXPECT_EQ(table.column_2[*row], components[1]);
+            EXPECT_EQ(table.column_3[*row], components[2]);
+        }
+    }
+    EXPECT_FALSE(circuit_constructor.failed());
+    EXPECT_TRUE(circuit_constructor.check_circuit());
+
+    // A key the table does not hold fails the circuit
+    auto read_values = plookup::get_lookup_accumulators(MultiTableId::UINT32_XOR, 1, 2, true);
+    read_values.key_entries[0].key[0] = 1 << 20;
+    circuit_constructor.create_gates_from_plookup_accumulators(MultiTableId::UINT32_XOR,
+                                                               read_values,
+                                                               circuit_constructor.add_variable(1),
+                                                               circuit_constructor.add_variable(2));
+    EXPECT_TRUE(circuit_constructor.failed());
+}
+
 TEST(ultra_circuit_constructor, base_case)
 {
     UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
@@ -214,7 +293,7 @@ TEST(ultra_circuit_constructor, non_trivial_tag_permutation)
     EXPECT_TRUE(saved_state.is_same_state(circuit_constructor));
 
     // Break the tag
-    circuit_constructor.real_variable_tags[circuit_constructor.real_variable_index[a_idx]] = 2;
+    circuit_constructor.real_variable_tags[circuit_constructor.get_real_variable_index(a_idx)] = 2;
     EXPECT_EQ(circuit_constructor.check_circuit(), false);
 }
 
@@ -259,7 +338,7 @@ TEST(ultra_circuit_constructor, non_trivial_tag_permutation_and_cycles)
     EXPECT_TRUE(saved_state.is_same_state(circuit_constructor));
 
     // Break the tag
-    circuit_constructor.real_variable_tags[circuit_constructor.real_variable_index[a_idx]] = 2;
+    circuit_constructor.real_variable_tags[circuit_constructor.get_real_variable_index(a_idx)] = 2;
     EXPECT_EQ(circuit_constructor.check_circuit(), false);
 }
 TEST(ultra_circuit_constructor, bad_tag_permutation)
@@ -769,6 +848,73 @@ TEST(ultra_circuit_constructor, ram)
     EXPECT_TRUE(saved_state.is_same_state(circuit_constructor));
 }
 
+TEST(ultra_circuit_constructor, many_memory_arrays)
+{
+    // Arrays of several sizes, some left partly uninitialized, read and written in an interleaved order
+    constexpr size_t num_arrays = 24;
+    auto build_circuit = [&](const bool correct_reads) {
+        auto& debug_engine = numeric::random::get_debug_engine(true);
+        UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
+        std::vector<size_t> rom_ids;
+        std::vector<size_t> ram_ids;
+        std::vector<size_t> sizes;
+        for (size_t i = 0; i < num_arrays; ++i) {
+            const size_t size = 1 + (i * 7) % 33;
+            sizes.emplace_back(size);
+            rom_ids.emplace_back(circuit_constructor.create_ROM_array(size));
+            ram_ids.emplace_back(circuit_constructor.create_RAM_array(size));
+            for (size_t j = 0; j < size; j += 1 + (i % 2)) {
+                circuit_constructor.set_ROM_element(
+                    rom_ids.back(), j, circuit_constructor.add_variable(debug_engine.get_random_uint64()));
+                circuit_constructor.init_RAM_element(
+                    ram_ids.back(), j, circuit_constructor.add_variable(debug_engine.get_random_uint64()));
+            }
+        }
+        std::vector<uint32_t> outputs;
+        for (size_t k = 0; k < 20 * num_arrays; ++k) {
+            const size_t i = debug_engine.get_random_uint64() % num_arrays;
+            const size_t index = debug_engine.get_random_uint64() % sizes[i];
+            const uint32_t index_witness = circuit_constructor.add_variable(index);
+            // Only initialized cells may be accessed before the circuit is finalized
+            if (index % (1 + (i % 2)) == 0) {
+                outputs.emplace_back(circuit_constructor.read_ROM_array(rom_ids[i], index_witness));
+                outputs.emplace_back(circuit_constructor.read_RAM_array(ram_ids[i], index_witness));
+                circuit_constructor.write_RAM_array(
+                    ram_ids[i], index_witness, circuit_constructor.add_variable(debug_engine.get_random_uint64()));
+            }
+        }
+        if (!correct_reads) {
+            circuit_constructor.variables[outputs[outputs.size() / 2]] += 1;
+        }
+        circuit_constructor.create_dummy_constraints(outputs);
+        circuit_constructor.finalize_circuit();
+        return circuit_constructor;
+    };
+
+    auto circuit_constructor = build_circuit(true);
+    EXPECT_TRUE(circuit_constructor.check_circuit());
+    // Every ROM and RAM gate is paired with a gate of the sorted lists
+    size_t num_records = 0;
+    for (const auto& rom_array : circuit_constructor.rom_arrays) {
+        num_records += rom_array.records.size();
+    }
+    for (const auto& ram_array : circuit_constructor.ram_arrays) {
+        num_records += ram_array.records.size();
+    }
+    EXPECT_EQ(circuit_constructor.memory_read_records.size() + circuit_constructor.memory_write_records.size(),
+              2 * num_records);
+    // The circuit does not depend on how the arrays were split between threads
+    auto same_circuit = build_circuit(true);
+    EXPECT_EQ(same_circuit.variables, circuit_constructor.variables);
+    EXPECT_EQ(same_circuit.w_l, circuit_constructor.w_l);
+    EXPECT_EQ(same_circuit.w_4, circuit_constructor.w_4);
+    EXPECT_EQ(same_circuit.q_aux, circuit_constructor.q_aux);
+    EXPECT_EQ(same_circuit.memory_read_records, circuit_constructor.memory_read_records);
+    EXPECT_EQ(same_circuit.memory_write_records, circuit_constructor.memory_write_records);
+
+    EXPECT_FALSE(build_circuit(false).check_circuit());
+}
+
 TEST(ultra_circuit_constructor, range_checks_on_duplicates)
 {
     UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
@@ -804,6 +950,60 @@ TEST(ultra_circuit_constructor, range_checks_on_duplicates)
     EXPECT_EQ(result, true);
 }
 
+TEST(ultra_circuit_constructor, range_lists_of_many_sizes)
+{
+    // Short lists, and a list long enough to be split between threads, with duplicates and copy constraints
+    const std::vector<std::pair<uint64_t, size_t>> ranges_and_sizes{ { 3, 2 }, { 100, 1000 }, { (1 << 14) - 1, 50000 } };
+    auto build_circuit = [&](const bool in_range) {
+        auto& debug_engine = numeric::random::get_debug_engine(true);
+        UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
+        std::vector<uint32_t> indices;
+        for (const auto& [range, size] : ranges_and_sizes) {
+            for (size_t i = 0; i < size; ++i) {
+                const uint64_t value = debug_engine.get_random_uint64() % (range + 1);
+                const uint32_t index = circuit_constructor.add_variable(value);
+                circuit_constructor.create_new_range_constraint(index, range);
+                indices.emplace_back(index);
+                if (i % 7 == 0) {
+                    const uint32_t duplicate = circuit_constructor.add_variable(value);
+                    circuit_constructor.assert_equal(index, duplicate);
+                    circuit_constructor.create_new_range_constraint(duplicate, range);
+                }
+            }
+        }
+        if (!in_range) {
+            indices.emplace_back(circuit_constructor.add_variable(101));
+            circuit_constructor.create_new_range_constraint(indices.back(), 100);
+        }
+        circuit_constructor.create_dummy_constraints(indices);
+        circuit_constructor.finalize_circuit();
+        return circuit_constructor;
+    };
+
+    auto circuit_constructor = build_circuit(true);
+    EXPECT_TRUE(circuit_constructor.check_circuit());
+    // Each list's mirror variables hold its values in order, one for each distinct variable
+    for (const auto& [range, list] : circuit_constructor.range_lists) {
+        std::vector<uint256_t> mirrored_values;
+        for (size_t i = 0; i < circuit_constructor.variables.size(); ++i) {
+            if (circuit_constructor.real_variable_tags[i] == list.tau_tag) {
+                mirrored_values.emplace_back(circuit_constructor.variables[i]);
+            }
+        }
+        EXPECT_EQ(mirrored_values.size(), list.variable_indices.size());
+        EXPECT_TRUE(std::is_sorted(mirrored_values.begin(), mirrored_values.end()));
+        EXPECT_EQ(mirrored_values.back(), range);
+    }
+    // The circuit does not depend on how the lists were split between threads
+    auto same_circuit = build_circuit(true);
+    EXPECT_EQ(same_circuit.variables, circuit_constructor.variables);
+    EXPECT_EQ(same_circuit.w_l, circuit_constructor.w_l);
+    EXPECT_EQ(same_circuit.w_4, circuit_constructor.w_4);
+    EXPECT_EQ(same_circuit.q_c, circuit_constructor.q_c);
+
+    EXPECT_FALSE(build_circuit(false).check_circuit());
+}
+
 TEST(ultra_circuit_constructor, check_circuit_showcase)
 {
     UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
@@ -840,4 +1040,145 @@ TEST(ultra_circuit_constructor, check_circuit_showcase)
     EXPECT_EQ(circuit_constructor.check_circuit(), true);
 }
 
+TEST(ultra_circuit_constructor, copy_constraint_classes)
+{
+    UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
+    const uint32_t accumulator = circuit_constructor.add_variable(fr(5));
+    circuit_constructor.set_variable_name(accumulator, "accumulator");
+    std::vector<uint32_t> chain;
+    for (size_t i = 0; i < 1000; ++i) {
+        const uint32_t variable = circuit_constructor.add_variable(fr(5));
+        // Alternate which side the large class is on, and merge in pairs of small classes too
+        if (i % 3 == 0) {
+            circuit_constructor.assert_equal(accumulator, variable);
+        } else if (i % 3 == 1) {
+            circuit_constructor.assert_equal(variable, accumulator);
+        } else {
+            const uint32_t other = circuit_constructor.add_variable(fr(5));
+            circuit_constructor.assert_equal(variable, other);
+            circuit_constructor.assert_equal(chain.back(), other);
+        }
+        chain.push_back(variable);
+        circuit_constructor.create_add_gate(
+            { variable, circuit_constructor.zero_idx, circuit_constructor.zero_idx, 1, 0, 0, -5 });
+    }
+    EXPECT_FALSE(circuit_constructor.failed());
+
+    const uint32_t real_index = circuit_constructor.get_real_variable_index(accumulator);
+    const auto real_variable_indices = circuit_constructor.get_real_variable_indices();
+    for (const auto& variable : chain) {
+        EXPECT_EQ(circuit_constructor.get_real_variable_index(variable), real_index);
+    }
+    for (uint32_t i = 0; i < circuit_constructor.get_num_variables(); ++i) {
+        EXPECT_EQ(real_variable_indices[i], circuit_constructor.get_real_variable_index(i));
+    }
+    // The classes stay balanced: no variable is more than log2(#variables) steps from its root
+    for (uint32_t i = 0; i < circuit_constructor.get_num_variables(); ++i) {
+        size_t depth = 0;
+        for (uint32_t index = i; circuit_constructor.parent_var_index[index] != index;
+             index = circuit_constructor.parent_var_index[index]) {
+            ++depth;
+        }
+        EXPECT_LE(depth, numeric::get_msb(circuit_constructor.get_num_variables()));
+    }
+    // The class's cycle runs through all of its members
+    size_t class_size = 0;
+    uint32_t index = accumulator;
+    do {
+        EXPECT_EQ(circuit_constructor.get_real_variable_index(index), real_index);
+        index = circuit_constructor.next_var_index[index];
+        ++class_size;
+    } while (index != accumulator);
+    EXPECT_EQ(class_size, 1 + 1000 + 333);
+    // The name of the class follows its root
+    circuit_constructor.update_variable_names(accumulator);
+    EXPECT_EQ(circuit_constructor.variable_names.size(), 1UL);
+    EXPECT_EQ(circuit_constructor.variable_names.begin()->first, circuit_constructor.get_class_root(accumulator));
+    EXPECT_TRUE(circuit_constructor.check_circuit());
+
+    // A merged class keeps the value of the first argument's class
+    const uint32_t a = circuit_constructor.add_variable(fr(1));
+    const uint32_t b = circuit_constructor.add_variable(fr(2));
+    circuit_constructor.assert_equal(b, accumulator);
+    EXPECT_TRUE(circuit_constructor.failed());
+    EXPECT_EQ(circuit_constructor.get_variable(accumulator), fr(2));
+    circuit_constructor.assert_equal(a, chain[500]);
+    EXPECT_EQ(circuit_constructor.get_variable(b), fr(1));
+    EXPECT_EQ(circuit_constructor.get_real_variable_index(chain[999]), a);
+}
+
+TEST(ultra_circuit_constructor, find_circuit_failure)
+{
+    UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
+    // Enough gates to be split between threads
+    const size_t num_gates = 1 << 14;
+    std::vector<size_t> bad_gates;
+    for (size_t i = 0; i < num_gates; ++i) {
+        fr a = fr::random_element(&engine);
+        fr b = fr::random_element(&engine);
+        fr c = a * b;
+        if (i == 5000 || i == 12000) {
+            c += 1;
+            bad_gates.push_back(circuit_constructor.num_gates);
+        }
+        circuit_constructor.create_mul_gate({ circuit_constructor.add_variable(a),
+                                              circuit_constructor.add_variable(b),
+                                              circuit_constructor.add_variable(c),
+                                              fr(1),
+                                              fr(-1),
+                                              fr(0) });
+    }
+
+    // The failure found is the earliest, with the values of the gate's wires
+    auto failure = circuit_constructor.find_circuit_failure();
+    ASSERT_TRUE(failure.has_value());
+    EXPECT_EQ(failure->check, "arithmetic");
+    EXPECT_EQ(failure->gate_index, bad_gates[0]);
+    EXPECT_EQ(failure->wire_values[0] * failure->wire_values[1] + 1, failure->wire_values[2]);
+    EXPECT_EQ(circuit_constructor.check_circuit(), false);
+}
+
+TEST(ultra_circuit_constructor, check_new_gates)
+{
+    UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
+    auto add_mul_gate = [&](bool correct) {
+        fr a = fr::random_element(&engine);
+        fr b = fr::random_element(&engine);
+        fr c = correct ? a * b : a * b + 1;
+        circuit_constructor.create_mul_gate({ circuit_constructor.add_variable(a),
+                                              circuit_constructor.add_variable(b),
+                                              circuit_constructor.add_variable(c),
+                                              fr(1),
+                                              fr(-1),
+                                              fr(0) });
+    };
+    for (size_t i = 0; i < 10; ++i) {
+        add_mul_gate(true);
+    }
+    EXPECT_FALSE(circuit_constructor.check_new_gates().has_value());
+    // The last gate waits for its successor
+    EXPECT_EQ(circuit_constructor.num_gates_checked, circuit_constructor.num_gates - 1);
+
+    // Gates which read memory are checked before the circuit is finalized
+    const size_t rom_id = circuit_constructor.create_ROM_array(4);
+    for (size_t i = 0; i < 4; ++i) {
+        circuit_constructor.set_ROM_element(rom_id, i, circuit_constructor.add_variable(fr(i * 7)));
+    }
+    const uint32_t value = circuit_constructor.read_ROM_array(rom_id, circuit_constructor.add_variable(fr(2)));
+    EXPECT_EQ(circuit_constructor.get_variable(value), fr(14));
+    add_mul_gate(true);
+    EXPECT_FALSE(circuit_constructor.check_new_gates().has_value());
+
+    const size_t bad_gate = circuit_constructor.num_gates;
+    add_mul_gate(false);
+    add_mul_gate(true);
+    auto failure = circuit_constructor.check_new_gates();
+    ASSERT_TRUE(failure.has_value());
+    EXPECT_EQ(failure->check, "arithmetic");
+    EXPECT_EQ(failure->gate_index, bad_gate);
+    // The failing gate is checked again by the next call
+    EXPECT_TRUE(circuit_constructor.check_new_gates().has_value());
+    EXPECT_EQ(circuit_constructor.check_circuit(), false);
+}
+
 } // namespace proof_system
\ No newline at end of file
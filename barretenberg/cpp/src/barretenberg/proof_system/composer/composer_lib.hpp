@@ -45,9 +45,7 @@ void construct_selector_polynomials(const typename Flavor::CircuitBuilder& circu
         // Copy the selector values for all gates, keeping the rows at which we store public inputs as 0.
         // Initializing the polynomials in this way automatically applies 0-padding to the selectors.
         typename Flavor::Polynomial selector_poly_lagrange(proving_key->circuit_size);
-        for (size_t i = 0; i < selector_values.size(); ++i) {
-            selector_poly_lagrange[i + gate_offset] = selector_values[i];
-        }
+        selector_values.copy_to(&selector_poly_lagrange[gate_offset]);
         if constexpr (IsHonkFlavor<Flavor>) {
             // TODO(#398): Loose coupling here of arithmetization and flavor.
             proving_key->_precomputed_polynomials[selector_idx] = selector_poly_lagrange;
@@ -82,8 +82,8 @@ std::vector<CyclicPermutation> compute_wire_copy_cycles(const typename Flavor::C
     std::vector<CyclicPermutation> copy_cycles(number_of_cycles);
     copy_cycles.reserve(num_gates * 3);
 
-    // Represents the index of a variable in circuit_constructor.variables
-    std::span<const uint32_t> real_variable_index = circuit_constructor.real_variable_index;
+    // Represents the index of a variable in circuit_constructor.variables, with all copy constraints resolved
+    const std::vector<uint32_t> real_variable_index = circuit_constructor.get_real_variable_indices();
 
     // For some flavors, we need to ensure the value in the 0th index of each wire is 0 to allow for left-shift by 1. To
     // do this, we add the wires of the first gate in the execution trace to the "zero index" copy cycle.
@@ -113,7 +113,7 @@ std::vector<CyclicPermutation> compute_wire_copy_cycles(const typename Flavor::C
         // Iterate over all variables of the ecc op gates, and add a corresponding node to the cycle for that variable
         for (size_t i = 0; i < num_ecc_op_gates; ++i) {
             for (size_t op_wire_idx = 0; op_wire_idx < Flavor::NUM_WIRES; ++op_wire_idx) {
-                const uint32_t var_index = circuit_constructor.real_variable_index[op_wires[op_wire_idx][i]];
+                const uint32_t var_index = real_variable_index[op_wires[op_wire_idx][i]];
                 const auto wire_index = static_cast<uint32_t>(op_wire_idx);
                 const auto gate_idx = static_cast<uint32_t>(i + op_gates_offset);
                 copy_cycles[var_index].emplace_back(cycle_node{ wire_index, gate_idx });
@@ -150,7 +150,7 @@ std::vector<CyclicPermutation> compute_wire_copy_cycles(const typename Flavor::C
             // of the `constructor.variables` vector.
             // Therefore, we add (i,j) to the cycle at index `var_index` to indicate that w^j_i should have the values
             // constructor.variables[var_index].
-            const uint32_t var_index = circuit_constructor.real_variable_index[wire[i]];
+            const uint32_t var_index = real_variable_index[wire[i]];
             const auto wire_index = static_cast<uint32_t>(wire_idx);
             const auto gate_idx = static_cast<uint32_t>(i + gates_offset);
             copy_cycles[var_index].emplace_back(cycle_node{ wire_index, gate_idx });
@@ -423,23 +423,39 @@ void compute_plonk_permutation_lagrange_polynomials_from_mapping(
 template <size_t program_width>
 void compute_monomial_and_coset_fft_polynomials_from_lagrange(std::string label, plonk::proving_key* key)
 {
-    for (size_t i = 0; i < program_width; ++i) {
-        std::string index = std::to_string(i + 1);
-        std::string prefix = label + "_" + index;
+    // As for the selectors, the polynomials are transformed together unless the store is under a memory budget.
+    const size_t batch_size = key->polynomial_store.get_memory_budget() == 0 ? program_width : 1;
+    for (size_t first = 0; first < program_width; first += batch_size) {
+        const size_t end = std::min(first + batch_size, program_width);
 
         // Construct permutation polynomials in lagrange base
-        auto sigma_polynomial_lagrange = key->polynomial_store.get(prefix + "_lagrange");
-        // Compute permutation polynomial monomial form
-        barretenberg::polynomial sigma_polynomial(key->circuit_size);
-        barretenberg::polynomial_arithmetic::ifft(
-            (barretenberg::fr*)&sigma_polynomial_lagrange[0], &sigma_polynomial[0], key->small_domain);
-
-        // Compute permutation polynomial coset FFT form
-        barretenberg::polynomial sigma_fft(sigma_polynomial, key->large_domain.size);
-        sigma_fft.coset_fft(key->large_domain);
-
-        key->polynomial_store.put(prefix, std::move(sigma_polynomial));
-        key->polynomial_store.put(prefix + "_fft", std::move(sigma_fft));
+        std::vector<barretenberg::polynomial> sigma_polynomials;
+        std::vector<barretenberg::fr*> sigma_coeffs;
+        sigma_polynomials.reserve(end - first);
+        for (size_t i = first; i < end; ++i) {
+            std::string prefix = label + "_" + std::to_string(i + 1);
+            auto sigma_polynomial_lagrange = key->polynomial_store.get(prefix + "_lagrange");
+            sigma_polynomials.emplace_back(sigma_polynomial_lagrange, key->circuit_size);
+            sigma_coeffs.push_back(sigma_polynomials.back().data().get());
+        }
+        // Compute permutation polynomial monomial forms
+        barretenberg::polynomial_arithmetic::ifft_batch(sigma_coeffs, key->small_domain);
+
+        // Compute permutation polynomial coset FFT forms
+        std::vector<barretenberg::polynomial> sigma_ffts;
+        std::vector<barretenberg::fr*> sigma_fft_coeffs;
+        sigma_ffts.reserve(end - first);
+        for (auto& sigma_polynomial : sigma_polynomials) {
+            sigma_ffts.emplace_back(sigma_polynomial, key->large_domain.size);
+            sigma_fft_coeffs.push_back(sigma_ffts.back().data().get());
+        }
+        barretenberg::polynomial_arithmetic::coset_fft_batch(sigma_fft_coeffs, key->large_domain);
+
+        for (size_t i = first; i < end; ++i) {
+            std::string prefix = label + "_" + std::to_string(i + 1);
+            key->polynomial_store.put(prefix, std::move(sigma_polynomials[i - first]));
+            key->polynomial_store.put(prefix + "_fft", std::move(sigma_ffts[i - first]));
+        }
     }
 }
 
@@ -64,12 +64,14 @@
  */
 
 #pragma once
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_table.hpp"
 #include "barretenberg/polynomials/barycentric.hpp"
 #include "barretenberg/polynomials/evaluation_domain.hpp"
 #include "barretenberg/polynomials/univariate.hpp"
 #include "barretenberg/proof_system/types/circuit_type.hpp"
 #include <array>
 #include <concepts>
+#include <memory>
 #include <vector>
 
 namespace proof_system::honk::flavor {
@@ -166,8 +168,11 @@ class ProvingKey_ : public PrecomputedPolynomials, public WitnessPolynomials {
  * @brief Base verification key class.
  *
  * @tparam PrecomputedEntities An instance of PrecomputedEntities_ with affine_element data type and handle type.
+ * @tparam Curve The curve of the native commitments, for which the key can precompute fixed-base tables; void for keys
+ * whose commitments are circuit types.
  */
-template <typename PrecomputedCommitments> class VerificationKey_ : public PrecomputedCommitments {
+template <typename PrecomputedCommitments, typename Curve = void>
+class VerificationKey_ : public PrecomputedCommitments {
   public:
     VerificationKey_() = default;
     VerificationKey_(const size_t circuit_size, const size_t num_public_inputs)
@@ -176,6 +181,21 @@ template <typename PrecomputedCommitments> class VerificationKey_ : public Preco
         this->log_circuit_size = numeric::get_msb(circuit_size);
         this->num_public_inputs = num_public_inputs;
     };
+
+    // Optional fixed-base tables for the commitments, with which the verifier batches them using only additions.
+    std::shared_ptr<const barretenberg::scalar_multiplication::FixedBaseTables<Curve>> commitment_tables;
+
+    /**
+     * @brief Precompute the fixed-base tables of the commitments. Each takes (2^w - 1).⌈254 / w⌉ points of memory.
+     */
+    void precompute_commitment_tables(
+        size_t window_bits = barretenberg::scalar_multiplication::FixedBaseTable<Curve>::DEFAULT_WINDOW_BITS)
+        requires(!std::is_void_v<Curve>)
+    {
+        const auto& commitments = this->_data;
+        commitment_tables = std::make_shared<const barretenberg::scalar_multiplication::FixedBaseTables<Curve>>(
+            std::span{ commitments.data(), commitments.size() }, window_bits);
+    }
 };
 
 /**
@@ -1,5 +1,8 @@
 #include "plookup_tables.hpp"
 #include "barretenberg/common/constexpr_utils.hpp"
+#include <algorithm>
+#include <memory>
+#include <mutex>
 
 namespace plookup {
 
@@ -9,8 +12,19 @@ namespace {
 // TODO(@zac-williamson) convert these into static const members of a struct
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 std::array<MultiTable, MultiTableId::NUM_MULTI_TABLES> MULTI_TABLES;
-// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
-bool inited = false;
+
+struct BasicTableRegistry {
+#ifndef NO_MULTITHREADING
+    std::mutex mutex;
+#endif
+    std::array<std::unique_ptr<const BasicTable>, BasicTableId::NUM_BASIC_TABLES> tables;
+};
+
+BasicTableRegistry& get_basic_table_registry()
+{
+    static BasicTableRegistry registry;
+    return registry;
+}
 
 void init_multi_tables()
 {
@@ -113,13 +127,98 @@ void init_multi_tables()
 
 const MultiTable& create_table(const MultiTableId id)
 {
-    if (!inited) {
+    // Initialised on first use; the initialisation of a static local is thread-safe.
+    [[maybe_unused]] static const bool inited = [] {
         init_multi_tables();
-        inited = true;
-    }
+        return true;
+    }();
     return MULTI_TABLES[id];
 }
 
+namespace {
+// The key as two 64-bit limbs, or nullopt if it does not fit
+std::optional<std::array<uint64_t, 2>> to_64_bit_key(const uint256_t& key_1, const uint256_t& key_2)
+{
+    if ((key_1.data[1] | key_1.data[2] | key_1.data[3] | key_2.data[1] | key_2.data[2] | key_2.data[3]) != 0) {
+        return std::nullopt;
+    }
+    return std::array<uint64_t, 2>{ key_1.data[0], key_2.data[0] };
+}
+} // namespace
+
+TableRowIndex::TableRowIndex(const TableColumn& column_1, const TableColumn& column_2, const bool use_twin_keys)
+    : num_rows(column_1.size())
+    , use_twin_keys(use_twin_keys)
+{
+    std::vector<std::array<uint64_t, 2>> keys;
+    keys.reserve(num_rows);
+    for (size_t i = 0; i < num_rows; ++i) {
+        const auto key = to_64_bit_key(uint256_t(column_1[i]), use_twin_keys ? uint256_t(column_2[i]) : 0);
+        if (!key.has_value()) {
+            throw_or_abort("table keys must fit in 64 bits");
+        }
+        keys.emplace_back(*key);
+    }
+    if (use_twin_keys) {
+        // The number of rows before key_1 first changes
+        key_2_range = 0;
+        while (key_2_range < num_rows && keys[key_2_range][0] == keys[0][0]) {
+            ++key_2_range;
+        }
+        key_2_range = std::max(key_2_range, uint64_t(1));
+    }
+    bool keys_in_order = true;
+    for (size_t i = 0; i < num_rows && keys_in_order; ++i) {
+        keys_in_order = keys[i][0] == i / key_2_range && keys[i][1] == i % key_2_range;
+    }
+    if (keys_in_order) {
+        return;
+    }
+    auto map = std::make_shared<std::unordered_map<std::array<uint64_t, 2>, uint32_t, KeyHash>>();
+    map->reserve(num_rows);
+    for (size_t i = 0; i < num_rows; ++i) {
+        // A key listed twice maps to its first row
+        map->emplace(keys[i], static_cast<uint32_t>(i));
+    }
+    rows = std::move(map);
+}
+
+std::optional<uint32_t> TableRowIndex::find(const std::array<uint256_t, 2>& key) const
+{
+    // Single-key tables ignore the second key
+    const auto key_64 = to_64_bit_key(key[0], use_twin_keys ? key[1] : 0);
+    if (!key_64.has_value()) {
+        return std::nullopt;
+    }
+    const auto [key_1, key_2] = *key_64;
+    if (rows) {
+        const auto it = rows->find(*key_64);
+        return it == rows->end() ? std::nullopt : std::optional<uint32_t>(it->second);
+    }
+    if (key_1 >= num_rows || key_2 >= key_2_range || key_1 * key_2_range + key_2 >= num_rows) {
+        return std::nullopt;
+    }
+    return static_cast<uint32_t>(key_1 * key_2_range + key_2);
+}
+
+const BasicTable& get_shared_basic_table(const BasicTableId id)
+{
+    if (static_cast<size_t>(id) >= BasicTableId::NUM_BASIC_TABLES) {
+        throw_or_abort("table id does not exist");
+    }
+    auto& registry = get_basic_table_registry();
+#ifndef NO_MULTITHREADING
+    std::lock_guard<std::mutex> lock(registry.mutex);
+#endif
+    auto& table = registry.tables[static_cast<size_t>(id)];
+    if (!table) {
+        auto generated = create_basic_table(id, 0);
+        generated.row_index = TableRowIndex(generated.column_1, generated.column_2, generated.use_twin_keys);
+        table = std::make_unique<const BasicTable>(std::move(generated));
+    }
+    return *table;
+}
+
 ReadData<barretenberg::fr> get_lookup_accumulators(const MultiTableId id,
                                                    const fr& key_a,
                                                    const fr& key_b,
@@ -26,6 +26,14 @@ ReadData<barretenberg::fr> get_lookup_accumulators(MultiTableId id,
                                                    const barretenberg::fr& key_b = 0,
                                                    bool is_2_to_1_lookup = false);
 
+/**
+ * @brief The basic table with the given id, generated on first use and shared by every circuit in the process.
+ *
+ * @details Safe to call from several threads. Copies of the table share its columns, so a circuit using the table only
+ * stores its own table_index and lookup_gates.
+ */
+const BasicTable& get_shared_basic_table(BasicTableId id);
+
 inline BasicTable create_basic_table(const BasicTableId id, const size_t index)
 {
     // we have >50 basic fixed base tables so we match with some logic instead of a switch statement
@@ -1,6 +1,10 @@
 #pragma once
 
 #include <array>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "./fixed_base/fixed_base_params.hpp"
@@ -105,6 +109,7 @@ enum BasicTableId {
     KECCAK_RHO_7,
     KECCAK_RHO_8,
     KECCAK_RHO_9,
+    NUM_BASIC_TABLES,
 };
 
 enum MultiTableId {
@@ -290,6 +295,70 @@ struct MultiTable {
 
 // }
 
+/**
+ * @brief A column of a basic table.
+ *
+ * @details Copies of a column share its values, so every circuit using a table refers to the single copy kept by
+ * get_shared_basic_table rather than holding its own. Values are appended while the table is generated; appending to
+ * a column whose values are shared first gives it a copy of its own.
+ */
+class TableColumn {
+  public:
+    template <typename... Args> void emplace_back(Args&&... args)
+    {
+        mutable_values().emplace_back(std::forward<Args>(args)...);
+    }
+    void push_back(const barretenberg::fr& value) { mutable_values().push_back(value); }
+    void reserve(const size_t capacity) { mutable_values().reserve(capacity); }
+
+    size_t size() const { return values ? values->size() : 0; }
+    bool empty() const { return size() == 0; }
+    const barretenberg::fr& operator[](const size_t i) const { return (*values)[i]; }
+    const barretenberg::fr* data() const { return values ? values->data() : nullptr; }
+    const barretenberg::fr* begin() const { return data(); }
+    const barretenberg::fr* end() const { return data() + size(); }
+
+  private:
+    std::vector<barretenberg::fr>& mutable_values()
+    {
+        if (!values) {
+            values = std::make_shared<std::vector<barretenberg::fr>>();
+        } else if (values.use_count() > 1) {
+            values = std::make_shared<std::vector<barretenberg::fr>>(*values);
+        }
+        return *values;
+    }
+
+    std::shared_ptr<std::vector<barretenberg::fr>> values;
+};
+
+/**
+ * @brief Finds the row of a basic table holding the key of a lookup.
+ *
+ * @details Most tables list every key in order, so that the row follows from the key: it is key_1 for single-key
+ * tables, and key_1.n + key_2 for twin-key tables with n values of key_2. Other tables, e.g. those keyed by values in
+ * sparse form, keep a map from key to row, shared by every copy of the table.
+ */
+class TableRowIndex {
+  public:
+    TableRowIndex() = default;
+    TableRowIndex(const TableColumn& column_1, const TableColumn& column_2, bool use_twin_keys);
+
+    // The row holding the key, or nullopt if the table has no such key.
+    std::optional<uint32_t> find(const std::array<uint256_t, 2>& key) const;
+
+  private:
+    struct KeyHash {
+        size_t operator()(const std::array<uint64_t, 2>& key) const { return key[0] * 0x9e3779b97f4a7c15ULL ^ key[1]; }
+    };
+
+    size_t num_rows = 0;
+    bool use_twin_keys = false;
+    // The number of values of key_2 in a twin-key table listing its keys in order, and 1 in a single-key one
+    uint64_t key_2_range = 1;
+    std::shared_ptr<const std::unordered_map<std::array<uint64_t, 2>, uint32_t, KeyHash>> rows;
+};
+
 /**
  * @brief The structure contains the most basic table serving one function (for, example an xor table)
  *
@@ -327,10 +396,12 @@ struct BasicTable {
     barretenberg::fr column_1_step_size = barretenberg::fr(0);
     barretenberg::fr column_2_step_size = barretenberg::fr(0);
     barretenberg::fr column_3_step_size = barretenberg::fr(0);
-    std::vector<barretenberg::fr> column_1;
-    std::vector<barretenberg::fr> column_3;
-    std::vector<barretenberg::fr> column_2;
-    std::vector<KeyEntry> lookup_gates;
+    TableColumn column_1;
+    TableColumn column_3;
+    TableColumn column_2;
+    TableRowIndex row_index;
+    // The row read by each of the circuit's lookups into the table. Unlike the columns, these belong to the circuit.
+    std::vector<uint32_t> lookup_gates;
 
     std::array<barretenberg::fr, 2> (*get_values_from_key)(const std::array<uint64_t, 2>);
 };
@@ -1,18 +1,51 @@
 #include "polynomial_store.hpp"
 #include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
 #include <map>
 #include <string>
 #include <unordered_map>
+#include <vector>
+#ifndef __wasm__
+#include <unistd.h>
+#endif
 
 namespace proof_system {
 
+namespace {
+// Distinguishes the spill files of concurrent processes sharing a spill directory.
+std::string process_id()
+{
+#ifdef __wasm__
+    return "0";
+#else
+    return process_id();
+#endif
+}
+} // namespace
+
+SpilledPolynomial::~SpilledPolynomial()
+{
+    std::remove(path.c_str());
+}
+
 template <typename Fr> void PolynomialStore<Fr>::put(std::string const& key, Polynomial&& value)
 {
     // info("put ", key, ": ", value.hash());
     polynomial_map[key] = std::move(value);
+    spilled_map.erase(key);
+    touch(key);
     // info("poly store put: ", key, " ", get_size_in_bytes() / (1024 * 1024), "MB");
+    if (memory_budget != 0) {
+        enforce_memory_budget(key);
+    }
+    peak_size_in_bytes = std::max(peak_size_in_bytes, get_size_in_bytes());
 };
 
 /**
@@ -25,8 +58,14 @@ template <typename Fr> void PolynomialStore<Fr>::put(std::string const& key, Pol
 template <typename Fr> barretenberg::Polynomial<Fr> PolynomialStore<Fr>::get(std::string const& key)
 {
     // info("poly store get: ", key);
+    if (spilled_map.contains(key)) {
+        return unspill(key);
+    }
     // Take a shallow copy of the polynomial. Compiler will move the shallow copy to call site.
     auto p = polynomial_map.at(key).clone();
+    if (memory_budget != 0) {
+        touch(key);
+    }
     // info("got ", key, ": ", p.hash());
     return p;
 };
@@ -38,12 +77,100 @@ template <typename Fr> barretenberg::Polynomial<Fr> PolynomialStore<Fr>::get(std
  */
 template <typename Fr> void PolynomialStore<Fr>::remove(std::string const& key)
 {
-    ASSERT(polynomial_map.contains(key));
+    ASSERT(contains(key));
     polynomial_map.erase(key);
+    spilled_map.erase(key);
+    last_use.erase(key);
 };
 
+template <typename Fr> void PolynomialStore<Fr>::set_memory_budget(size_t bytes, std::string const& spill_dir)
+{
+    memory_budget = bytes;
+    spill_directory = spill_dir;
+    if (spill_directory.empty()) {
+        const char* tmpdir = std::getenv("TMPDIR");
+        spill_directory = tmpdir != nullptr ? tmpdir : "/tmp";
+    }
+    if (memory_budget != 0) {
+        enforce_memory_budget("");
+    }
+}
+
+/**
+ * @brief Write the polynomial to a file, and release the store's reference to its memory.
+ */
+template <typename Fr> void PolynomialStore<Fr>::spill(std::string const& key)
+{
+    static std::atomic<size_t> spill_count = 0;
+    auto& polynomial = polynomial_map.at(key);
+    auto path = spill_directory + "/bb_spill_" + std::to_string(getpid()) + "_" + std::to_string(spill_count++);
+
+    std::ofstream file(path, std::ios::binary);
+    auto bytes = polynomial.byte_span();
+    file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    if (!file.good()) {
+        throw_or_abort("PolynomialStore: failed to spill " + key + " to " + path);
+    }
+    // info("poly store spill: ", key, " ", bytes.size() / (1024 * 1024), "MB");
+    spilled_map[key] = std::make_shared<SpilledPolynomial>(path, polynomial.size());
+    polynomial_map.erase(key);
+}
+
+/**
+ * @brief Read a spilled polynomial back into memory, spilling others if that takes us over budget.
+ */
+template <typename Fr> barretenberg::Polynomial<Fr> PolynomialStore<Fr>::unspill(std::string const& key)
+{
+    auto spilled = spilled_map.at(key);
+    Polynomial polynomial(spilled->size);
+    std::ifstream file(spilled->path, std::ios::binary);
+    auto bytes = polynomial.byte_span();
+    file.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    if (!file.good()) {
+        throw_or_abort("PolynomialStore: failed to read back " + key + " from " + spilled->path);
+    }
+    // info("poly store unspill: ", key);
+    spilled_map.erase(key);
+    polynomial_map[key] = polynomial.clone();
+    touch(key);
+    enforce_memory_budget(key);
+    peak_size_in_bytes = std::max(peak_size_in_bytes, get_size_in_bytes());
+    return polynomial;
+}
+
+/**
+ * @brief Spill least recently used polynomials until we're within budget, or run out of polynomials to spill.
+ *
+ * @param key_in_use A polynomial that is about to be used, and so shouldn't be spilled.
+ */
+template <typename Fr> void PolynomialStore<Fr>::enforce_memory_budget(std::string const& key_in_use)
+{
+    size_t size_in_bytes = get_size_in_bytes();
+    if (size_in_bytes <= memory_budget) {
+        return;
+    }
+
+    std::vector<std::pair<size_t, std::string>> candidates;
+    for (auto& [key, polynomial] : polynomial_map) {
+        // A polynomial which has been handed out by get() still has its memory referenced by the caller (data()
+        // returns one more reference), so spilling it would free nothing.
+        if (key != key_in_use && polynomial.data().use_count() <= 2) {
+            candidates.emplace_back(last_use[key], key);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end());
+
+    for (auto& [_, key] : candidates) {
+        if (size_in_bytes <= memory_budget) {
+            break;
+        }
+        size_in_bytes -= polynomial_map.at(key).size() * sizeof(Fr);
+        spill(key);
+    }
+}
+
 /**
- * @brief Get the current size (bytes) of all polynomials in the PolynomialStore
+ * @brief Get the current size (bytes) of all polynomials held in memory by the PolynomialStore
  *
  * @return size_t
  */
@@ -4,16 +4,51 @@
 #include "barretenberg/polynomials/polynomial.hpp"
 #include <cstddef>
 #include <map>
+#include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
 
 namespace proof_system {
 
+/**
+ * @brief A polynomial spilled to disk, which is deleted when the last store referencing it lets go of it.
+ */
+class SpilledPolynomial {
+  public:
+    SpilledPolynomial(std::string path, size_t size)
+        : path(std::move(path))
+        , size(size)
+    {}
+    ~SpilledPolynomial();
+    SpilledPolynomial(const SpilledPolynomial&) = delete;
+    SpilledPolynomial(SpilledPolynomial&&) = delete;
+    SpilledPolynomial& operator=(const SpilledPolynomial&) = delete;
+    SpilledPolynomial& operator=(SpilledPolynomial&&) = delete;
+
+    std::string path;
+    size_t size;
+};
+
 template <typename Fr> class PolynomialStore {
   private:
     using Polynomial = barretenberg::Polynomial<Fr>;
     std::unordered_map<std::string, Polynomial> polynomial_map;
 
+    // Memory-budget mode. When the polynomials held in memory exceed memory_budget bytes, the least recently used are
+    // spilled to spill_directory and transparently read back on the next get.
+    size_t memory_budget = 0;
+    std::string spill_directory;
+    std::unordered_map<std::string, std::shared_ptr<SpilledPolynomial>> spilled_map;
+    std::unordered_map<std::string, size_t> last_use;
+    size_t use_count = 0;
+    size_t peak_size_in_bytes = 0;
+
+    void touch(std::string const& key) { last_use[key] = ++use_count; }
+    void spill(std::string const& key);
+    Polynomial unspill(std::string const& key);
+    void enforce_memory_budget(std::string const& key_in_use);
+
   public:
     /**
      * Transfer ownership of a polynomial to the PolynomialStore.
@@ -28,15 +63,30 @@ template <typename Fr> class PolynomialStore {
 
     void remove(std::string const& key);
 
+    /**
+     * @brief Bound the memory held by the store to the given number of bytes (0 for unbounded), spilling polynomials
+     * to files in spill_dir (default: the system temp directory) as needed.
+     * @details Only polynomials which aren't shared with a caller of get() are spilled, as spilling a shared polynomial
+     * wouldn't free its memory. The budget can therefore be exceeded while many polynomials are in use at once.
+     */
+    void set_memory_budget(size_t bytes, std::string const& spill_dir = "");
+    size_t get_memory_budget() const { return memory_budget; }
+
     size_t get_size_in_bytes() const;
 
+    /**
+     * @brief The largest get_size_in_bytes() seen since construction.
+     */
+    size_t get_peak_size_in_bytes() const { return peak_size_in_bytes; }
+
     void print();
 
     // Basic map methods
-    bool contains(std::string const& key) { return polynomial_map.contains(key); };
-    size_t size() { return polynomial_map.size(); };
+    bool contains(std::string const& key) { return polynomial_map.contains(key) || spilled_map.contains(key); };
+    size_t size() { return polynomial_map.size() + spilled_map.size(); };
+    bool is_spilled(std::string const& key) const { return spilled_map.contains(key); }
 
-    // Allow for const range based for loop
+    // Allow for const range based for loop. Note that only the polynomials held in memory are visited.
     typename std::unordered_map<std::string, Polynomial>::const_iterator begin() const
     {
         return polynomial_map.begin();
@@ -46,4 +96,4 @@ template <typename Fr> class PolynomialStore {
 
 extern template class PolynomialStore<barretenberg::fr>;
 
-} // namespace proof_system
\ No newline at end of file
+} // namespace proof_system
@@ -90,4 +90,56 @@ TEST(PolynomialStore, Remove)
     EXPECT_EQ(polynomial_store.get_size_in_bytes(), bytes_expected);
 }
 
+// Ensure that polynomials beyond the memory budget are spilled, and read back intact
+TEST(PolynomialStore, MemoryBudgetSpillsLeastRecentlyUsed)
+{
+    PolynomialStore<Fr> polynomial_store;
+    const size_t size = 1024;
+    polynomial_store.set_memory_budget(2 * size * sizeof(Fr));
+
+    std::vector<Polynomial> copies;
+    for (size_t i = 0; i < 3; ++i) {
+        Polynomial poly(size);
+        for (auto& coeff : poly) {
+            coeff = Fr::random_element();
+        }
+        copies.emplace_back(poly);
+        polynomial_store.put("id_" + std::to_string(i), std::move(poly));
+    }
+
+    // The first polynomial was the least recently used when the third took us over budget.
+    EXPECT_TRUE(polynomial_store.is_spilled("id_0"));
+    EXPECT_FALSE(polynomial_store.is_spilled("id_1"));
+    EXPECT_FALSE(polynomial_store.is_spilled("id_2"));
+    EXPECT_EQ(polynomial_store.size(), 3);
+    EXPECT_TRUE(polynomial_store.contains("id_0"));
+    EXPECT_EQ(polynomial_store.get_size_in_bytes(), 2 * size * sizeof(Fr));
+
+    // Reading it back spills the now least recently used polynomial in its place.
+    EXPECT_EQ(polynomial_store.get("id_0"), copies[0]);
+    EXPECT_TRUE(polynomial_store.is_spilled("id_1"));
+    EXPECT_EQ(polynomial_store.get("id_1"), copies[1]);
+    EXPECT_EQ(polynomial_store.get("id_2"), copies[2]);
+    EXPECT_LE(polynomial_store.get_peak_size_in_bytes(), 2 * size * sizeof(Fr));
+
+    polynomial_store.remove("id_0");
+    EXPECT_FALSE(polynomial_store.contains("id_0"));
+}
+
+// Ensure that polynomials still in use by a caller are not spilled, as that would free no memory
+TEST(PolynomialStore, MemoryBudgetKeepsPolynomialsInUse)
+{
+    PolynomialStore<Fr> polynomial_store;
+    const size_t size = 1024;
+    polynomial_store.set_memory_budget(size * sizeof(Fr));
+
+    polynomial_store.put("id_1", Polynomial(size));
+    auto in_use = polynomial_store.get("id_1");
+    polynomial_store.put("id_2", Polynomial(size));
+
+    EXPECT_FALSE(polynomial_store.is_spilled("id_1"));
+    EXPECT_FALSE(polynomial_store.is_spilled("id_2"));
+    EXPECT_EQ(polynomial_store.get_size_in_bytes(), 2 * size * sizeof(Fr));
+}
+
 } // namespace proof_system
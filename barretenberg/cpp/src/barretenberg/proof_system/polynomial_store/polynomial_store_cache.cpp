@@ -15,15 +15,15 @@ void PolynomialStoreCache::put(std::string const& key, Polynomial&& value)
     // info("cache put ", key);
     auto it = cache_.find(key);
     if (it != cache_.end()) {
-        it->second = std::move(value);
-        return;
+        erase_from_cache(it);
     }
 
-    purge_until_free();
-
     auto size = value.size();
+    purge_until_free(size * sizeof(barretenberg::fr));
+
     auto [cache_it, _] = cache_.insert({ key, std::move(value) });
     size_map_.insert({ size, cache_it });
+    cache_size_in_bytes_ += size * sizeof(barretenberg::fr);
 };
 
 PolynomialStoreCache::Polynomial PolynomialStoreCache::get(std::string const& key)
@@ -38,18 +38,50 @@ PolynomialStoreCache::Polynomial PolynomialStoreCache::get(std::string const& ke
     return external_store.get(key);
 };
 
-void PolynomialStoreCache::purge_until_free()
+void PolynomialStoreCache::remove(std::string const& key)
+{
+    auto it = cache_.find(key);
+    if (it != cache_.end()) {
+        erase_from_cache(it);
+    }
+    external_store.remove(key);
+}
+
+void PolynomialStoreCache::set_memory_budget(size_t bytes, std::string const& /*unused*/)
 {
-    while (cache_.size() >= max_cache_size_) {
+    memory_budget_ = bytes;
+    purge_until_free(0);
+}
+
+void PolynomialStoreCache::purge_until_free(size_t incoming_bytes)
+{
+    auto over_budget = [&]() {
+        return memory_budget_ != 0 && cache_size_in_bytes_ + incoming_bytes > memory_budget_;
+    };
+    while (!cache_.empty() && (cache_.size() >= max_cache_size_ || over_budget())) {
         auto size_it = size_map_.begin();
         auto [size, cache_it] = *size_it;
         auto key = cache_it->first;
         auto p = std::move(cache_it->second);
         size_map_.erase(size_it);
         cache_.erase(cache_it);
+        cache_size_in_bytes_ -= size * sizeof(barretenberg::fr);
         // info("cache purging ", key, " size ", size);
         external_store.put(key, std::move(p));
     }
 }
 
+void PolynomialStoreCache::erase_from_cache(std::map<std::string, Polynomial>::iterator it)
+{
+    auto range = size_map_.equal_range(it->second.size());
+    for (auto size_it = range.first; size_it != range.second; ++size_it) {
+        if (size_it->second == it) {
+            size_map_.erase(size_it);
+            break;
+        }
+    }
+    cache_size_in_bytes_ -= it->second.size() * sizeof(barretenberg::fr);
+    cache_.erase(it);
+}
+
 } // namespace proof_system
\ No newline at end of file
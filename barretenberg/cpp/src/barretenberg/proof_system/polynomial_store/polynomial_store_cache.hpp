@@ -10,7 +10,8 @@ namespace proof_system {
  * A cache that wraps an underlying external store. It favours holding the largest polynomials in it's cache up
  * to max_cache_size_ polynomials. This saves on many expensive copies of large amounts of memory to the external
  * store. Smaller polynomials get swapped out, but they're also much cheaper to read/write.
- * The default ctor sets the cache size to 70.
+ * The default ctor sets the cache size to 40.
+ * With a memory budget set, the cache is also kept within that many bytes.
  * In combination with the slab allocator, this brings us to about 4GB mem usage for 512k circuits.
  * In tests using just the external store increased proof time from by about 50%.
  * This pretty much recoups all losses.
@@ -22,6 +23,8 @@ class PolynomialStoreCache {
     std::multimap<size_t, std::map<std::string, Polynomial>::iterator> size_map_;
     PolynomialStoreWasm<barretenberg::fr> external_store;
     size_t max_cache_size_;
+    size_t memory_budget_ = 0;
+    size_t cache_size_in_bytes_ = 0;
 
   public:
     PolynomialStoreCache();
@@ -31,8 +34,20 @@ class PolynomialStoreCache {
 
     Polynomial get(std::string const& key);
 
+    void remove(std::string const& key);
+
+    bool contains(std::string const& key) { return cache_.contains(key) || external_store.contains(key); }
+
+    /**
+     * @brief Additionally bound the cache to the given number of bytes (0 for no bound). The spill_dir is unused, as
+     * the external store is always the spill location.
+     */
+    void set_memory_budget(size_t bytes, std::string const& spill_dir = "");
+    size_t get_memory_budget() const { return memory_budget_; }
+
   private:
-    void purge_until_free();
+    void purge_until_free(size_t incoming_bytes);
+    void erase_from_cache(std::map<std::string, Polynomial>::iterator it);
 };
 
 } // namespace proof_system
\ No newline at end of file
@@ -19,6 +19,14 @@ template <typename Fr> barretenberg::Polynomial<Fr> PolynomialStoreWasm<Fr>::get
     return p;
 };
 
+template <typename Fr> void PolynomialStoreWasm<Fr>::remove(std::string const& key)
+{
+    if (size_map.erase(key) != 0) {
+        // Release the environment's copy.
+        set_data(key.c_str(), nullptr, 0);
+    }
+};
+
 template class PolynomialStoreWasm<barretenberg::fr>;
 
 } // namespace proof_system
\ No newline at end of file
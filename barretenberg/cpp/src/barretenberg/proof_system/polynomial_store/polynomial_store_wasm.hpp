@@ -14,6 +14,10 @@ template <typename Fr> class PolynomialStoreWasm {
     void put(std::string const& key, Polynomial&& value);
 
     Polynomial get(std::string const& key);
+
+    void remove(std::string const& key);
+
+    bool contains(std::string const& key) const { return size_map.contains(key); }
 };
 
 extern template class PolynomialStoreWasm<barretenberg::fr>;
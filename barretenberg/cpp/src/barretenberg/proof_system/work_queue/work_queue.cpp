@@ -1,4 +1,5 @@
 #include "work_queue.hpp"
+#include "barretenberg/common/trace.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
@@ -201,6 +202,7 @@ void work_queue::add_to_queue(const work_item& item)
 
 void work_queue::process_queue()
 {
+    BB_TRACE_SCOPE_COUNTS("work_queue::process_queue", work_item_queue.size(), 0);
     for (const auto& item : work_item_queue) {
         switch (item.work_type) {
         // most expensive op
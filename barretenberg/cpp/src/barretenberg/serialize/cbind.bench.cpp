@@ -0,0 +1,67 @@
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/serialize/cbind.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+using barretenberg::fr;
+
+namespace {
+// Shaped like kernel/rollup simulation inputs: many membership witnesses plus an opaque proof.
+struct WitnessHeavyInputs {
+    std::vector<std::array<fr, 32>> sibling_paths;
+    std::vector<uint8_t> proof;
+    MSGPACK_FIELDS(sibling_paths, proof);
+};
+
+// Keep the function itself trivial so that only the calling convention overhead is measured.
+auto echo_paths = [](WitnessHeavyInputs const& inputs) { return inputs.sibling_paths; };
+
+std::pair<uint8_t*, size_t> encode_inputs(size_t num_paths)
+{
+    WitnessHeavyInputs inputs;
+    inputs.sibling_paths.resize(num_paths);
+    for (auto& path : inputs.sibling_paths) {
+        for (auto& node : path) {
+            node = fr::random_element();
+        }
+    }
+    inputs.proof.resize(64 * 1024);
+    return msgpack_encode_buffer(std::make_tuple(inputs));
+}
+
+void cbind_default(State& state) noexcept
+{
+    auto [input, input_len] = encode_inputs(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        uint8_t* output = nullptr;
+        size_t output_len = 0;
+        msgpack_cbind_impl(echo_paths, input, input_len, &output, &output_len);
+        DoNotOptimize(output);
+        aligned_free(output);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(input_len));
+    aligned_free(input);
+}
+BENCHMARK(cbind_default)->RangeMultiplier(4)->Range(16, 4096)->Unit(kMicrosecond);
+
+void cbind_zero_copy(State& state) noexcept
+{
+    auto [input, input_len] = encode_inputs(static_cast<size_t>(state.range(0)));
+    // Reused across calls, as an arena would be.
+    std::vector<uint8_t> arena(input_len);
+    for (auto _ : state) {
+        uint8_t* output = nullptr;
+        size_t output_len = 0;
+        msgpack_cbind_into_impl(echo_paths, input, input_len, arena.data(), arena.size(), &output, &output_len);
+        DoNotOptimize(output);
+        if (output != arena.data()) {
+            aligned_free(output);
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(input_len));
+    aligned_free(input);
+}
+BENCHMARK(cbind_zero_copy)->RangeMultiplier(4)->Range(16, 4096)->Unit(kMicrosecond);
+} // namespace
+
+BENCHMARK_MAIN();
@@ -73,6 +73,81 @@ inline void msgpack_cbind_impl(auto func,               // The function to be ap
     *output_len_out = output_len;
 }
 
+/**
+ * msgpack unpack reference function: have every STR/BIN/EXT object point into the input buffer rather than copying it
+ * into the unpack zone. Objects (and any views taken from them) are then only valid while the input buffer is.
+ */
+inline bool msgpack_reference_input(msgpack::type::object_type /*unused*/, size_t /*unused*/, void* /*unused*/)
+{
+    return true;
+}
+
+/**
+ * A msgpack write stream over a fixed, caller-owned buffer.
+ * Bytes that do not fit are dropped but still counted, so size() is always the full encoded size.
+ */
+class MsgpackSpanBuffer {
+  public:
+    MsgpackSpanBuffer(uint8_t* data, size_t capacity)
+        : data_(data)
+        , capacity_(capacity)
+    {}
+
+    void write(const char* buf, size_t len)
+    {
+        if (size_ + len <= capacity_) {
+            memcpy(data_ + size_, buf, len);
+        }
+        size_ += len;
+    }
+
+    size_t size() const { return size_; }
+    bool overflowed() const { return size_ > capacity_; }
+
+  private:
+    uint8_t* data_;
+    size_t capacity_;
+    size_t size_ = 0;
+};
+
+// Zero-copy variant of msgpack_cbind_impl for functions with large inputs/outputs (kernel and rollup simulation).
+// - Input BIN/STR data (e.g. every field element, proof bytes) is read in place from input_in, and the unpacked object
+//   is kept alive for the call, so func may take std::span<const uint8_t> parameters that view into input_in.
+// - The result is packed straight into the caller's output_in buffer. Only if it does not fit is a buffer allocated
+//   (with aligned_alloc, of exactly the encoded size); *output_out tells the caller which one holds the result.
+inline void msgpack_cbind_into_impl(auto func,
+                                    const uint8_t* input_in,
+                                    size_t input_len_in,
+                                    uint8_t* output_in,
+                                    size_t output_capacity_in,
+                                    uint8_t** output_out,
+                                    size_t* output_len_out)
+{
+    auto params = param_tuple<decltype(func)>();
+
+    // The handle owns nothing but the object tree; all raw data stays in input_in.
+    msgpack::object_handle const handle =
+        msgpack::unpack((const char*)input_in, input_len_in, msgpack_reference_input, nullptr);
+    handle.get().convert(params);
+
+    auto const result = std::apply(func, params);
+
+    MsgpackSpanBuffer buffer(output_in, output_capacity_in);
+    msgpack::pack(buffer, result);
+    if (!buffer.overflowed()) {
+        *output_out = output_in;
+        *output_len_out = buffer.size();
+        return;
+    }
+
+    // Caller's buffer was too small: encode again into an exactly sized allocation rather than re-running func.
+    auto* output = (uint8_t*)aligned_alloc(64, buffer.size());
+    MsgpackSpanBuffer exact_buffer(output, buffer.size());
+    msgpack::pack(exact_buffer, result);
+    *output_out = output;
+    *output_len_out = exact_buffer.size();
+}
+
 // returns a C-style string json of the schema
 inline void msgpack_cbind_schema_impl(auto func, uint8_t** output_out, size_t* output_len_out)
 {
@@ -106,3 +181,19 @@ inline void msgpack_cbind_schema_impl(auto func, uint8_t** output_out, size_t* o
     {                                                                                                                  \
         msgpack_cbind_schema_impl(func, output_out, output_len_out);                                                   \
     }
+
+// The CBIND_ZERO_COPY macro generates everything CBIND does, plus a cname##__into function using the zero-copy calling
+// convention of msgpack_cbind_into_impl. Intended for bindings whose inputs carry large arrays of fields/proofs.
+// If *output_out != output_in on return, the caller owns (and must free) *output_out.
+#define CBIND_ZERO_COPY(cname, func)                                                                                   \
+    CBIND(cname, func)                                                                                                 \
+    WASM_EXPORT void cname##__into(const uint8_t* input_in,                                                            \
+                                   size_t input_len_in,                                                                \
+                                   uint8_t* output_in,                                                                 \
+                                   size_t output_capacity_in,                                                          \
+                                   uint8_t** output_out,                                                               \
+                                   size_t* output_len_out)                                                             \
+    {                                                                                                                  \
+        msgpack_cbind_into_impl(                                                                                       \
+            func, input_in, input_len_in, output_in, output_capacity_in, output_out, output_len_out);                  \
+    }
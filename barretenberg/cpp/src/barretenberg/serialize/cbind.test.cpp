@@ -0,0 +1,113 @@
+#include "barretenberg/serialize/cbind.hpp"
+#include "barretenberg/serialize/test_helper.hpp"
+
+#include <gtest/gtest.h>
+#include <span>
+
+using barretenberg::fr;
+
+namespace {
+struct LargeInputs {
+    std::vector<std::array<fr, 16>> sibling_paths;
+    std::vector<uint8_t> proof;
+    MSGPACK_FIELDS(sibling_paths, proof);
+};
+
+LargeInputs random_large_inputs(size_t num_paths, size_t proof_size)
+{
+    LargeInputs inputs;
+    inputs.sibling_paths.resize(num_paths);
+    for (auto& path : inputs.sibling_paths) {
+        for (auto& node : path) {
+            node = fr::random_element();
+        }
+    }
+    inputs.proof.resize(proof_size);
+    for (size_t i = 0; i < proof_size; ++i) {
+        inputs.proof[i] = static_cast<uint8_t>(i);
+    }
+    return inputs;
+}
+
+auto sum_paths = [](LargeInputs const& inputs) {
+    std::vector<fr> sums;
+    for (auto const& path : inputs.sibling_paths) {
+        fr sum = 0;
+        for (auto const& node : path) {
+            sum += node;
+        }
+        sums.push_back(sum);
+    }
+    return sums;
+};
+
+auto call_into(auto func, LargeInputs const& inputs, std::vector<uint8_t>& output_buffer)
+{
+    auto [input, input_len] = msgpack_encode_buffer(std::make_tuple(inputs));
+    uint8_t* output = nullptr;
+    size_t output_len = 0;
+    msgpack_cbind_into_impl(func, input, input_len, output_buffer.data(), output_buffer.size(), &output, &output_len);
+    aligned_free(input);
+
+    std::vector<fr> result;
+    msgpack::unpack((const char*)output, output_len).get().convert(result);
+    bool const used_caller_buffer = output == output_buffer.data();
+    if (!used_caller_buffer) {
+        aligned_free(output);
+    }
+    return std::make_pair(result, used_caller_buffer);
+}
+} // namespace
+
+TEST(cbind_tests, zero_copy_matches_default_cbind)
+{
+    auto inputs = random_large_inputs(64, 1024);
+    auto cbind = [](const uint8_t* input_in, size_t input_len_in, uint8_t** output_out, size_t* output_len_out) {
+        msgpack_cbind_impl(sum_paths, input_in, input_len_in, output_out, output_len_out);
+    };
+    auto expected = call_msgpack_cbind<std::vector<fr>>(cbind, inputs);
+
+    std::vector<uint8_t> output_buffer(1 << 16);
+    auto [result, used_caller_buffer] = call_into(sum_paths, inputs, output_buffer);
+    EXPECT_TRUE(used_caller_buffer);
+    EXPECT_EQ(result, expected);
+}
+
+TEST(cbind_tests, zero_copy_falls_back_to_allocation)
+{
+    auto inputs = random_large_inputs(64, 0);
+
+    // Far too small for 64 encoded field elements, so the result must come back in a fresh allocation.
+    std::vector<uint8_t> output_buffer(16);
+    auto [result, used_caller_buffer] = call_into(sum_paths, inputs, output_buffer);
+    EXPECT_FALSE(used_caller_buffer);
+    EXPECT_EQ(result, sum_paths(inputs));
+}
+
+TEST(cbind_tests, zero_copy_span_views_input)
+{
+    std::vector<uint8_t> blob(4096);
+    for (size_t i = 0; i < blob.size(); ++i) {
+        blob[i] = static_cast<uint8_t>(i * 7);
+    }
+    auto [input, input_len] = msgpack_encode_buffer(std::make_tuple(blob));
+    const auto* input_begin = input;
+    const auto* input_end = input + input_len;
+
+    bool viewed_input = false;
+    auto func = [&](std::span<const uint8_t> view) {
+        viewed_input = view.data() >= input_begin && view.data() + view.size() <= input_end;
+        return std::vector<uint8_t>(view.begin(), view.end());
+    };
+
+    std::vector<uint8_t> output_buffer(8192);
+    uint8_t* output = nullptr;
+    size_t output_len = 0;
+    msgpack_cbind_into_impl(func, input, input_len, output_buffer.data(), output_buffer.size(), &output, &output_len);
+    aligned_free(input);
+
+    std::vector<uint8_t> result;
+    msgpack::unpack((const char*)output, output_len).get().convert(result);
+    EXPECT_TRUE(viewed_input);
+    EXPECT_EQ(result, blob);
+}
@@ -9,3 +9,12 @@
     WASM_EXPORT void cname(                                                                                            \
         const uint8_t* input_in, size_t input_len_in, uint8_t** output_out, size_t* output_len_out);                   \
     WASM_EXPORT void cname##__schema(uint8_t** output_out, size_t* output_len_out);
+
+#define CBIND_ZERO_COPY_DECL(cname)                                                                                    \
+    CBIND_DECL(cname)                                                                                                  \
+    WASM_EXPORT void cname##__into(const uint8_t* input_in,                                                            \
+                                   size_t input_len_in,                                                                \
+                                   uint8_t* output_in,                                                                 \
+                                   size_t output_capacity_in,                                                          \
+                                   uint8_t** output_out,                                                               \
+                                   size_t* output_len_out);
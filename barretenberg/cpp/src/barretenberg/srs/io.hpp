@@ -1,6 +1,7 @@
 #pragma once
 #include "../ecc/curves/bn254/bn254.hpp"
 #include "../ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/common/trace.hpp"
 #include <concepts>
 #include <cstdint>
 #include <fstream>
@@ -281,6 +282,7 @@ template <typename Curve> class IO {
 
     static void read_transcript_g1(AffineElement* monomials, size_t degree, std::string const& dir)
     {
+        BB_TRACE_SCOPE_COUNTS("srs::read_transcript_g1", degree, degree * sizeof(AffineElement));
         size_t num = 0;
         size_t num_read = 0;
         std::string path = get_transcript_path(dir, num);
@@ -13,6 +13,7 @@
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/test.hpp"
 #include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
+#include "barretenberg/ecc/scalar_multiplication/small_msm.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
 #include "barretenberg/srs/io.hpp"
@@ -1057,3 +1058,56 @@ TYPED_TEST(ScalarMultiplicationTests, PippengerMulByZero)
 
     EXPECT_EQ(result.is_point_at_infinity(), true);
 }
+
+TYPED_TEST(ScalarMultiplicationTests, SmallMsm)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+    using namespace barretenberg::scalar_multiplication;
+
+    for (size_t num_points : { 1UL, 7UL, 40UL, SMALL_MSM_THRESHOLD }) {
+        std::vector<Fr> scalars(num_points);
+        std::vector<AffineElement> points(num_points);
+        for (size_t i = 0; i < num_points; ++i) {
+            scalars[i] = Fr::random_element();
+            points[i] = AffineElement(Element::random_element());
+        }
+        // Edge cases a verifier may meet: repeated and negated points, points at infinity and zero scalars.
+        if (num_points > 4) {
+            points[1] = points[0];
+            points[2] = -points[0];
+            points[3].self_set_infinity();
+            scalars[4] = Fr::zero();
+        }
+
+        Element expected;
+        expected.self_set_infinity();
+        for (size_t i = 0; i < num_points; ++i) {
+            if (!points[i].is_point_at_infinity()) {
+                expected += points[i] * scalars[i];
+            }
+        }
+
+        EXPECT_EQ(AffineElement(small_msm<Curve>(&scalars[0], &points[0], num_points)), AffineElement(expected));
+        EXPECT_EQ(AffineElement(small_msm<Curve, 2>(&scalars[0], &points[0], num_points)), AffineElement(expected));
+        EXPECT_EQ(AffineElement(small_msm<Curve, 8>(&scalars[0], &points[0], num_points)), AffineElement(expected));
+
+        pippenger_runtime_state<Curve> state(num_points);
+        Element result = pippenger_without_endomorphism_basis_points<Curve>(&scalars[0], &points[0], num_points, state);
+        EXPECT_EQ(AffineElement(result), AffineElement(expected));
+
+        // Through pippenger, with the points in a point table.
+        std::vector<AffineElement> point_table(num_points * 2);
+        generate_pippenger_point_table<Curve>(&points[0], &point_table[0], num_points);
+        result = pippenger<Curve>(&scalars[0], &point_table[0], num_points, state);
+        EXPECT_EQ(AffineElement(result), AffineElement(expected));
+    }
+
+    // The largest and smallest scalars, whose signed digits carry into the top window.
+    std::vector<Fr> scalars = { Fr::neg_one(), Fr::one(), Fr(uint256_t(1) << 253) };
+    std::vector<AffineElement> points(3, AffineElement(Element::random_element()));
+    EXPECT_EQ(AffineElement(small_msm<Curve>(&scalars[0], &points[0], 3)),
+              AffineElement(Element(points[0]) * (Fr::neg_one() + Fr::one() + scalars[2])));
+}
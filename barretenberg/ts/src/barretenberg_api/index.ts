@@ -311,6 +311,24 @@ export class BarretenbergApi {
     return result[0];
   }
 
+  async acirAccumulateProof(acirComposerPtr: Ptr, proofBuf: Uint8Array, isRecursive: boolean): Promise<void> {
+    const result = await this.binder.callWasmExport(
+      'acir_accumulate_proof',
+      [acirComposerPtr, proofBuf, isRecursive],
+      [],
+    );
+    return;
+  }
+
+  async acirVerifyAccumulatedProofs(acirComposerPtr: Ptr): Promise<boolean> {
+    const result = await this.binder.callWasmExport(
+      'acir_verify_accumulated_proofs',
+      [acirComposerPtr],
+      [BoolDeserializer()],
+    );
+    return result[0];
+  }
+
   async acirGetSolidityVerifier(acirComposerPtr: Ptr): Promise<string> {
     const result = await this.binder.callWasmExport(
       'acir_get_solidity_verifier',
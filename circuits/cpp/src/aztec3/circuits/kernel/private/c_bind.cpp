@@ -30,19 +30,19 @@ using aztec3::circuits::kernel::private_kernel::utils::dummy_previous_kernel;
 
 CBIND(private_kernel__dummy_previous_kernel, []() { return dummy_previous_kernel(); });
 
-CBIND(private_kernel__sim_init, [](PrivateKernelInputsInit<NT> private_inputs) {
+CBIND_ZERO_COPY(private_kernel__sim_init, [](PrivateKernelInputsInit<NT> const& private_inputs) {
     DummyCircuitBuilder builder = DummyCircuitBuilder("private_kernel__sim_init");
     auto const& public_inputs = native_private_kernel_circuit_initial(builder, private_inputs);
     return builder.result_or_error(public_inputs);
 });
 
-CBIND(private_kernel__sim_inner, [](PrivateKernelInputsInner<NT> private_inputs) {
+CBIND_ZERO_COPY(private_kernel__sim_inner, [](PrivateKernelInputsInner<NT> const& private_inputs) {
     DummyCircuitBuilder builder = DummyCircuitBuilder("private_kernel__sim_inner");
     auto const& public_inputs = native_private_kernel_circuit_inner(builder, private_inputs);
     return builder.result_or_error(public_inputs);
 });
 
-CBIND(private_kernel__sim_ordering, [](PrivateKernelInputsOrdering<NT> private_inputs) {
+CBIND_ZERO_COPY(private_kernel__sim_ordering, [](PrivateKernelInputsOrdering<NT> const& private_inputs) {
     DummyCircuitBuilder builder = DummyCircuitBuilder("private_kernel__sim_ordering");
     auto const& public_inputs = native_private_kernel_circuit_ordering(builder, private_inputs);
     return builder.result_or_error(public_inputs);
@@ -5,6 +5,6 @@
 #include <cstdint>
 
 CBIND_DECL(private_kernel__dummy_previous_kernel);
-CBIND_DECL(private_kernel__sim_init);
-CBIND_DECL(private_kernel__sim_inner);
-CBIND_DECL(private_kernel__sim_ordering);
+CBIND_ZERO_COPY_DECL(private_kernel__sim_init);
+CBIND_ZERO_COPY_DECL(private_kernel__sim_inner);
+CBIND_ZERO_COPY_DECL(private_kernel__sim_ordering);
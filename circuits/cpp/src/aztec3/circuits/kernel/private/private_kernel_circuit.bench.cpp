@@ -0,0 +1,79 @@
+#include "index.hpp"
+#include "init.hpp"
+#include "testing_harness.hpp"
+
+#include "aztec3/circuits/apps/test_apps/escrow/deposit.hpp"
+
+#include <barretenberg/barretenberg.hpp>
+#include <barretenberg/benchmark/e2e_bench/e2e_bench.hpp>
+#include <barretenberg/plonk/composer/ultra_composer.hpp>
+
+/**
+ * End-to-end benchmarks of the private kernel, reporting in the same JSON format as barretenberg's e2e_bench, so that
+ * the results can be gated on with barretenberg/cpp/src/barretenberg/benchmark/e2e_bench/compare.py. Run from the
+ * build directory.
+ */
+
+namespace {
+
+using aztec3::NUM_FIELDS_PER_SHA256;
+using aztec3::circuits::apps::test_apps::escrow::deposit;
+using aztec3::circuits::kernel::private_kernel::Builder;
+using aztec3::circuits::kernel::private_kernel::private_kernel_circuit;
+using aztec3::circuits::kernel::private_kernel::testing_harness::do_private_call_get_kernel_inputs_inner;
+using e2e_bench::Measurement;
+using e2e_bench::Workload;
+
+/**
+ * @brief Construct, prove and verify an iteration of the private kernel for a call to the escrow deposit function.
+ * @details The app proof and the previous kernel proof are read from fixtures rather than constructed.
+ */
+void prove_private_kernel(Measurement& measurement, bool first_iteration)
+{
+    NT::fr const amount = 5;
+    NT::fr const asset_id = 1;
+    NT::fr const memo = 999;
+    std::array<NT::fr, NUM_FIELDS_PER_SHA256> const logs_hash = { NT::fr(16), NT::fr(69) };
+    NT::fr const log_preimages_length = NT::fr(100);
+
+    auto const private_inputs = measurement.time_stage("generate_inputs", [&] {
+        return do_private_call_get_kernel_inputs_inner(false,
+                                                       deposit,
+                                                       { amount, asset_id, memo },
+                                                       logs_hash,
+                                                       logs_hash,
+                                                       log_preimages_length,
+                                                       log_preimages_length,
+                                                       logs_hash,
+                                                       logs_hash,
+                                                       log_preimages_length,
+                                                       log_preimages_length,
+                                                       true);
+    });
+
+    Builder builder;
+    measurement.time_stage("construct_circuit",
+                           [&] { private_kernel_circuit(builder, private_inputs, first_iteration); });
+    measurement.num_gates = builder.get_num_gates();
+
+    proof_system::plonk::UltraComposer composer;
+    auto prover = measurement.time_stage("construct_proving_key", [&] { return composer.create_prover(builder); });
+    auto proof = measurement.time_stage("prove", [&] { return prover.construct_proof(); });
+    measurement.verified = measurement.time_stage("verify", [&] {
+        auto verifier = composer.create_verifier(builder);
+        return verifier.verify_proof(proof);
+    });
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    barretenberg::srs::init_crs_factory("../barretenberg/cpp/srs_db/ignition");
+
+    std::vector<Workload> const workloads = {
+        { "private_kernel/init", [](Measurement& m) { prove_private_kernel(m, true); } },
+        { "private_kernel/inner", [](Measurement& m) { prove_private_kernel(m, false); } },
+    };
+    return e2e_bench::run_suite(argc, argv, workloads);
+}
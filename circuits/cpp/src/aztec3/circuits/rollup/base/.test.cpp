@@ -721,6 +721,48 @@ TEST_F(base_rollup_tests, native_subtree_height_is_0)
     ASSERT_FALSE(builder.failed()) << builder.failure_msgs;
 }
 
+TEST_F(base_rollup_tests, native_batch_matches_individual_simulations)
+{
+    std::vector<BaseRollupInputs> batch_inputs;
+
+    batch_inputs.push_back(base_rollup_inputs_from_kernels({ get_empty_kernel(), get_empty_kernel() }));
+
+    std::array<PreviousKernelData<NT>, 2> kernel_data = { get_empty_kernel(), get_empty_kernel() };
+    kernel_data[0].public_inputs.end.new_contracts[0] = NewContractData<NT>{
+        .contract_address = fr(1),
+        .portal_contract_address = fr(3),
+        .function_tree_root = fr(2),
+    };
+    batch_inputs.push_back(base_rollup_inputs_from_kernels(kernel_data));
+
+    BaseRollupInputs bad_chain_id_inputs = base_rollup_inputs_from_kernels({ get_empty_kernel(), get_empty_kernel() });
+    bad_chain_id_inputs.constants.global_variables.chain_id = 3;
+    batch_inputs.push_back(bad_chain_id_inputs);
+
+    auto const results = aztec3::circuits::rollup::native_base_rollup::base_rollup_circuit_batch(batch_inputs);
+    ASSERT_EQ(results.size(), batch_inputs.size());
+
+    for (size_t i = 0; i < batch_inputs.size(); i++) {
+        DummyCircuitBuilder builder = DummyCircuitBuilder("base_rollup_tests__native_batch_matches_individual");
+        BaseOrMergeRollupPublicInputs const expected =
+            aztec3::circuits::rollup::native_base_rollup::base_rollup_circuit(builder, batch_inputs[i]);
+
+        if (builder.failed()) {
+            auto const* error = std::get_if<aztec3::utils::CircuitError>(&results[i].result);
+            ASSERT_NE(error, nullptr);
+            ASSERT_EQ(error->message, builder.get_first_failure().message);
+        } else {
+            auto const* public_inputs = std::get_if<BaseOrMergeRollupPublicInputs>(&results[i].result);
+            ASSERT_NE(public_inputs, nullptr);
+            ASSERT_EQ(public_inputs->end_private_data_tree_snapshot, expected.end_private_data_tree_snapshot);
+            ASSERT_EQ(public_inputs->end_nullifier_tree_snapshot, expected.end_nullifier_tree_snapshot);
+            ASSERT_EQ(public_inputs->end_contract_tree_snapshot, expected.end_contract_tree_snapshot);
+            ASSERT_EQ(public_inputs->end_public_data_tree_root, expected.end_public_data_tree_root);
+            ASSERT_EQ(public_inputs->calldata_hash, expected.calldata_hash);
+        }
+    }
+}
+
 TEST_F(base_rollup_tests, native_cbind_0)
 {
     // @todo Error handling?
@@ -16,11 +16,16 @@ using NT = aztec3::utils::types::NativeTypes;
 using DummyCircuitBuilder = aztec3::utils::DummyCircuitBuilder;
 using aztec3::circuits::abis::BaseRollupInputs;
 using aztec3::circuits::rollup::native_base_rollup::base_rollup_circuit;
+using aztec3::circuits::rollup::native_base_rollup::base_rollup_circuit_batch;
 }  // namespace
 
 // WASM Cbinds
-CBIND(base_rollup__sim, [](BaseRollupInputs<NT> const& base_rollup_inputs) {
+CBIND_ZERO_COPY(base_rollup__sim, [](BaseRollupInputs<NT> const& base_rollup_inputs) {
     DummyCircuitBuilder builder = DummyCircuitBuilder("base_rollup__sim");
     auto const& public_inputs = base_rollup_circuit(builder, base_rollup_inputs);
     return builder.result_or_error(public_inputs);
+});
+
+CBIND_ZERO_COPY(base_rollup__sim_batch, [](std::vector<BaseRollupInputs<NT>> const& base_rollup_inputs) {
+    return base_rollup_circuit_batch(base_rollup_inputs);
 });
\ No newline at end of file
@@ -5,4 +5,5 @@
 #include <cstddef>
 #include <cstdint>
 
-CBIND_DECL(base_rollup__sim);
\ No newline at end of file
+CBIND_ZERO_COPY_DECL(base_rollup__sim);
+CBIND_ZERO_COPY_DECL(base_rollup__sim_batch);
\ No newline at end of file
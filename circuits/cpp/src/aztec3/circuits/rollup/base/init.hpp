@@ -27,6 +27,7 @@ using BaseRollupInputs = abis::BaseRollupInputs<NT>;
 using BaseOrMergeRollupPublicInputs = abis::BaseOrMergeRollupPublicInputs<NT>;
 using DummyBuilder = aztec3::utils::DummyCircuitBuilder;
 using CircuitErrorCode = aztec3::utils::CircuitErrorCode;
+template <typename T> using CircuitResult = aztec3::utils::CircuitResult<T>;
 
 using Aggregator = aztec3::circuits::recursion::Aggregator;
 using AggregationObject = utils::types::NativeTypes::AggregationObject;
@@ -547,4 +547,26 @@ BaseOrMergeRollupPublicInputs base_rollup_circuit(DummyBuilder& builder, BaseRol
     return public_inputs;
 }
 
+/**
+ * @brief Simulate a batch of base rollups (e.g. every pair of txs in a block) in parallel
+ * @details A base rollup only reads its own inputs: the membership witnesses and sibling paths against the historic,
+ * contract, private data and nullifier trees are all carried in `BaseRollupInputs`, and the empty subtree roots are
+ * shared read-only (see `components::calculate_empty_tree_root`). The simulations are therefore independent and are
+ * spread across threads, each with its own DummyBuilder so that failures are reported per base rollup.
+ *
+ * @param batchBaseRollupInputs
+ * @return The public inputs (or first circuit error) of each base rollup, in input order
+ */
+std::vector<CircuitResult<BaseOrMergeRollupPublicInputs>> base_rollup_circuit_batch(
+    std::vector<BaseRollupInputs> const& batchBaseRollupInputs)
+{
+    std::vector<CircuitResult<BaseOrMergeRollupPublicInputs>> results(batchBaseRollupInputs.size());
+    parallel_for(batchBaseRollupInputs.size(), [&](size_t i) {
+        DummyBuilder builder = DummyBuilder(format("base_rollup_circuit_batch[", i, "]"));
+        auto const public_inputs = base_rollup_circuit(builder, batchBaseRollupInputs[i]);
+        results[i] = builder.result_or_error(public_inputs);
+    });
+    return results;
+}
+
 }  // namespace aztec3::circuits::rollup::native_base_rollup
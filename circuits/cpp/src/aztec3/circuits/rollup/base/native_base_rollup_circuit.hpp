@@ -14,4 +14,7 @@ namespace aztec3::circuits::rollup::native_base_rollup {
 
 BaseOrMergeRollupPublicInputs base_rollup_circuit(DummyBuilder& builder, BaseRollupInputs const& baseRollupInputs);
 
+std::vector<CircuitResult<BaseOrMergeRollupPublicInputs>> base_rollup_circuit_batch(
+    std::vector<BaseRollupInputs> const& batchBaseRollupInputs);
+
 }  // namespace aztec3::circuits::rollup::native_base_rollup
\ No newline at end of file
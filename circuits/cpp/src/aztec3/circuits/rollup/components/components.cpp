@@ -16,14 +16,32 @@
 
 namespace aztec3::circuits::rollup::components {
 
+// Deepest empty tree whose root is cached by `calculate_empty_tree_root`. Covers every subtree inserted by the rollup
+// circuits; deeper trees fall back to building the empty tree.
+constexpr size_t MAX_CACHED_EMPTY_TREE_DEPTH = PRIVATE_DATA_TREE_HEIGHT;
+
 /**
  * @brief Get the root of an empty tree of a given depth
+ * @details Every rollup simulation asks for the empty roots of the same few subtree heights, so the chain of zero
+ * hashes is computed once and then shared read-only between calls (and threads, see `base_rollup_circuit_batch`).
  *
  * @param depth
  * @return NT::fr
  */
 NT::fr calculate_empty_tree_root(const size_t depth)
 {
+    static const std::vector<NT::fr> empty_tree_roots = []() {
+        std::vector<NT::fr> roots(MAX_CACHED_EMPTY_TREE_DEPTH + 1);
+        roots[0] = NT::fr(0);
+        for (size_t i = 1; i < roots.size(); ++i) {
+            roots[i] = stdlib::merkle_tree::hash_pair_native(roots[i - 1], roots[i - 1]);
+        }
+        return roots;
+    }();
+    if (depth < empty_tree_roots.size()) {
+        return empty_tree_roots[depth];
+    }
+
     MemoryStore empty_tree_store;
     MerkleTree const empty_tree = MerkleTree(empty_tree_store, depth);
     return empty_tree.root();